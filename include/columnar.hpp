@@ -0,0 +1,292 @@
+// CrossBench columnar export: format definition and header-only reader.
+//
+// data/leaderboard_all.cbcol holds the same records as leaderboard_all.json,
+// one column per field. The file is self-describing and memory-mappable: a
+// consumer maps it, looks a column up in the directory and reads it in place
+// without parsing any other column.
+//
+// Layout (little-endian, every section starts on an 8-byte boundary):
+//
+//   Header (40 bytes)
+//     char     magic[8]          "CBCOLUMN"
+//     uint32   version           1
+//     uint32   byte_order        0x01020304 as stored by the writer
+//     uint64   row_count
+//     uint32   column_count
+//     uint32   reserved          0
+//     uint64   directory_offset
+//
+//   Directory: column_count x ColumnEntry (72 bytes each)
+//     char     name[32]          NUL-padded, e.g. "ranks.overall"
+//     uint32   type              Float64 = 1, Int32 = 2, Bool8 = 3, DictString = 4
+//     uint32   reserved          0
+//     uint64   data_offset, data_length
+//     uint64   dict_offset, dict_length     DictString only, otherwise 0
+//
+//   Column data
+//     Float64     row_count IEEE-754 doubles
+//     Int32       row_count int32
+//     Bool8       row_count bytes, 0 or 1
+//     DictString  row_count uint32 codes into the column's dictionary
+//
+//   Dictionary (DictString columns)
+//     uint32   count
+//     uint32   offsets[count + 1]   entry i is bytes[offsets[i], offsets[i + 1])
+//     char     bytes[]              UTF-8, not NUL-terminated
+//
+// Column names follow the JSON export: "name", "org", "metrics.score",
+// "ranks.overall", "meta.is_open_source", ... Rows are in registry order.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Columnar {
+
+constexpr char MAGIC[8] = {'C', 'B', 'C', 'O', 'L', 'U', 'M', 'N'};
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+enum class Type : uint32_t { Float64 = 1, Int32 = 2, Bool8 = 3, DictString = 4 };
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t row_count;
+    uint32_t column_count;
+    uint32_t reserved;
+    uint64_t directory_offset;
+};
+
+struct ColumnEntry {
+    char name[32];
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t data_offset;
+    uint64_t data_length;
+    uint64_t dict_offset;
+    uint64_t dict_length;
+};
+
+static_assert(sizeof(Header) == 40, "Header layout is part of the file format");
+static_assert(sizeof(ColumnEntry) == 72, "ColumnEntry layout is part of the file format");
+
+inline uint64_t Align8(uint64_t n) { return (n + 7) & ~uint64_t(7); }
+
+inline size_t Width(Type t) {
+    switch (t) {
+        case Type::Float64:    return 8;
+        case Type::Int32:      return 4;
+        case Type::Bool8:      return 1;
+        case Type::DictString: return 4;
+    }
+    return 0;
+}
+
+// Typed view of one column inside a file image. Accessors do no bounds
+// checking on `row`; the Reader validated every offset when it opened.
+class Column {
+    const unsigned char* base;
+    const ColumnEntry* entry;
+    uint64_t rows;
+
+    template <typename T>
+    T Load(uint64_t offset) const {
+        T v;
+        std::memcpy(&v, base + offset, sizeof v);
+        return v;
+    }
+
+public:
+    Column(const unsigned char* b, const ColumnEntry* e, uint64_t r) : base(b), entry(e), rows(r) {}
+
+    std::string_view Name() const {
+        const void* nul = std::memchr(entry->name, '\0', sizeof entry->name);
+        size_t len = nul ? static_cast<size_t>(static_cast<const char*>(nul) - entry->name) : sizeof entry->name;
+        return std::string_view(entry->name, len);
+    }
+    Type GetType() const { return static_cast<Type>(entry->type); }
+    size_t Size() const { return static_cast<size_t>(rows); }
+    // Start of the column's values, 8-byte aligned within the file
+    const void* Data() const { return base + entry->data_offset; }
+
+    double F64(size_t row) const { return Load<double>(entry->data_offset + row * 8); }
+    int32_t I32(size_t row) const { return Load<int32_t>(entry->data_offset + row * 4); }
+    bool Bool(size_t row) const { return base[entry->data_offset + row] != 0; }
+    uint32_t Code(size_t row) const { return Load<uint32_t>(entry->data_offset + row * 4); }
+
+    size_t DictSize() const { return entry->dict_length ? Load<uint32_t>(entry->dict_offset) : 0; }
+    std::string_view DictEntry(size_t i) const {
+        uint64_t offsets = entry->dict_offset + 4;
+        uint64_t bytes = offsets + 4 * (DictSize() + 1);
+        uint32_t begin = Load<uint32_t>(offsets + 4 * i), end = Load<uint32_t>(offsets + 4 * (i + 1));
+        return std::string_view(reinterpret_cast<const char*>(base + bytes + begin), end - begin);
+    }
+    std::string_view String(size_t row) const { return DictEntry(Code(row)); }
+};
+
+// Validating reader over a complete file image, typically a MappedFile
+class Reader {
+    const unsigned char* base = nullptr;
+    size_t size = 0;
+    Header header{};
+
+    Reader() = default;
+
+    const ColumnEntry* Entry(size_t i) const {
+        return reinterpret_cast<const ColumnEntry*>(base + header.directory_offset) + i;
+    }
+
+    bool ValidColumn(const ColumnEntry& e) const {
+        Type t = static_cast<Type>(e.type);
+        size_t width = Width(t);
+        if (width == 0 || e.data_offset % 8 != 0) return false;
+        if (e.data_length % width != 0 || e.data_length / width != header.row_count) return false;
+        if (e.data_offset > size || e.data_length > size - e.data_offset) return false;
+        if (t != Type::DictString) return e.dict_length == 0;
+
+        if (e.dict_offset % 8 != 0 || e.dict_offset > size || e.dict_length > size - e.dict_offset || e.dict_length < 8) return false;
+        uint32_t count;
+        std::memcpy(&count, base + e.dict_offset, 4);
+        uint64_t bytesStart = 4 + 4 * (uint64_t(count) + 1);
+        if (bytesStart > e.dict_length) return false;
+        uint32_t prev = 0;
+        for (uint64_t i = 0; i <= count; ++i) {
+            uint32_t off;
+            std::memcpy(&off, base + e.dict_offset + 4 + 4 * i, 4);
+            if (off < prev || bytesStart + off > e.dict_length) return false;
+            prev = off;
+        }
+        for (uint64_t r = 0; r < header.row_count; ++r) {
+            uint32_t code;
+            std::memcpy(&code, base + e.data_offset + 4 * r, 4);
+            if (code >= count) return false;
+        }
+        return true;
+    }
+
+public:
+    // nullopt if the image is not a well-formed version-1 file
+    static std::optional<Reader> Open(const void* data, size_t size) {
+        Reader r;
+        r.base = static_cast<const unsigned char*>(data);
+        r.size = size;
+        if (size < sizeof(Header) || reinterpret_cast<uintptr_t>(data) % 8 != 0) return std::nullopt;
+        std::memcpy(&r.header, data, sizeof(Header));
+        const Header& h = r.header;
+        if (std::memcmp(h.magic, MAGIC, sizeof MAGIC) != 0 || h.version != VERSION || h.byte_order != BYTE_ORDER_MARK) return std::nullopt;
+        if (h.directory_offset % 8 != 0 || h.directory_offset > size ||
+            uint64_t(h.column_count) * sizeof(ColumnEntry) > size - h.directory_offset) return std::nullopt;
+        for (size_t i = 0; i < h.column_count; ++i) {
+            if (!r.ValidColumn(*r.Entry(i))) return std::nullopt;
+        }
+        return r;
+    }
+
+    size_t Rows() const { return static_cast<size_t>(header.row_count); }
+    size_t ColumnCount() const { return header.column_count; }
+    Column At(size_t i) const { return Column(base, Entry(i), header.row_count); }
+
+    std::optional<Column> Find(std::string_view name) const {
+        for (size_t i = 0; i < header.column_count; ++i) {
+            Column c = At(i);
+            if (c.Name() == name) return c;
+        }
+        return std::nullopt;
+    }
+};
+
+// Read-only memory mapping of a whole file
+class MappedFile {
+    const void* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+
+    MappedFile() = default;
+
+    void Release() {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        file = INVALID_HANDLE_VALUE;
+        mapping = nullptr;
+#else
+        if (data) munmap(const_cast<void*>(data), size);
+        if (fd >= 0) close(fd);
+        fd = -1;
+#endif
+        data = nullptr;
+        size = 0;
+    }
+
+public:
+    static std::optional<MappedFile> Open(const std::string& path) {
+        MappedFile m;
+#ifdef _WIN32
+        m.file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m.file == INVALID_HANDLE_VALUE) return std::nullopt;
+        LARGE_INTEGER len;
+        if (!GetFileSizeEx(m.file, &len) || len.QuadPart == 0) return std::nullopt;
+        m.mapping = CreateFileMappingA(m.file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m.mapping) return std::nullopt;
+        m.data = MapViewOfFile(m.mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!m.data) return std::nullopt;
+        m.size = static_cast<size_t>(len.QuadPart);
+#else
+        m.fd = open(path.c_str(), O_RDONLY);
+        if (m.fd < 0) return std::nullopt;
+        struct stat st;
+        if (fstat(m.fd, &st) != 0 || st.st_size == 0) return std::nullopt;
+        void* p = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, m.fd, 0);
+        if (p == MAP_FAILED) return std::nullopt;
+        m.data = p;
+        m.size = static_cast<size_t>(st.st_size);
+#endif
+        return std::optional<MappedFile>(std::move(m));
+    }
+
+    MappedFile(MappedFile&& o) noexcept { *this = std::move(o); }
+    MappedFile& operator=(MappedFile&& o) noexcept {
+        if (this != &o) {
+            Release();
+            std::swap(data, o.data);
+            std::swap(size, o.size);
+#ifdef _WIN32
+            std::swap(file, o.file);
+            std::swap(mapping, o.mapping);
+#else
+            std::swap(fd, o.fd);
+#endif
+        }
+        return *this;
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { Release(); }
+
+    const void* Data() const { return data; }
+    size_t Size() const { return size; }
+};
+
+} // namespace Columnar
@@ -36,9 +36,32 @@
 #include <numeric>
 #include <memory>
 #include <set>
+#include <atomic>
+#include <string_view>
+#include <type_traits>
 #include <sstream>
 #include <filesystem>
+#include <functional>
+#include <array>
+#include <cstdint>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <stdexcept>
 #include "json.hpp"
+#include "columnar.hpp"
+
+// Optional compressed export siblings: build with -DCROSSBENCH_ZLIB (-lz)
+// and/or -DCROSSBENCH_ZSTD (-lzstd)
+#ifdef CROSSBENCH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef CROSSBENCH_ZSTD
+#include <zstd.h>
+#endif
 
 #pragma comment(lib, "winhttp.lib")
 
@@ -53,6 +76,11 @@ namespace Config {
     const int RETRY_DELAY_MS = 2000;
     const std::string OUTPUT_DIR = "output";
     const std::string DATA_DIR = "data";
+    const size_t DASHBOARD_ROWS = 1000; // Rows per dashboard tab and sort order
+    // Precompressed artifacts are written once and served many times; zstd
+    // levels past ~12 cost several times more CPU for a few percent
+    const int GZIP_LEVEL = 9;
+    const int ZSTD_LEVEL = 12;
     
     // Ranking Weights
     namespace Weights {
@@ -91,6 +119,22 @@ namespace Utils {
         std::cout << color << "[" << stage << "] " << message << RESET << std::endl;
     }
     
+    // 64-bit FNV-1a; pass a previous result as `h` to extend a hash
+    constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+    inline uint64_t Fnv1a(const void* data, size_t len, uint64_t h = FNV_OFFSET) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < len; ++i) h = (h ^ p[i]) * 0x100000001b3ull;
+        return h;
+    }
+
+    // Fixed-width lowercase hex, e.g. for content-hashed file names
+    inline std::string HexDigest(uint64_t h) {
+        static const char HEX[] = "0123456789abcdef";
+        std::string out(16, '0');
+        for (int i = 15; i >= 0; --i, h >>= 4) out[i] = HEX[h & 0xF];
+        return out;
+    }
+
     void EnsureDirectoryExists(const std::string& path) {
         if (!fs::exists(path)) fs::create_directories(path);
     }
@@ -115,6 +159,517 @@ namespace Utils {
     }
 }
 
+// --- Output Formatting ---
+// Files replaced / left alone by AtomicFile::Commit, summed across writer threads
+struct PublishTally {
+    std::atomic<size_t> replaced{0};
+    std::atomic<size_t> unchanged{0};
+};
+
+// Output file that is only touched when its contents change. Incoming bytes
+// are compared with the existing file as they arrive and nothing is written
+// while they match. On the first difference the matching prefix is copied
+// from the old file into path.tmp, the rest streams after it, and Commit()
+// renames the temp file over `path`: readers see the old file or the new
+// one, never a truncated one. Destroyed without Commit() (e.g. while unwinding
+// from a failed writer) it abandons the replacement.
+class AtomicFile {
+public:
+    enum class Outcome { Pending, Unchanged, Replaced, Failed };
+
+private:
+    static constexpr size_t CHUNK = 1 << 16;
+    std::string path, tempPath;
+    std::ios::openmode mode;
+    PublishTally* tally;
+    std::ifstream existing;
+    std::ofstream temp;
+    std::unique_ptr<char[]> chunk;
+    uint64_t length = 0; // Bytes received so far
+    bool diverged = false;
+    bool failed = false;
+    Outcome outcome = Outcome::Pending;
+
+    // Start the replacement file: the first `length` bytes equal the old file's
+    void Diverge() {
+        diverged = true;
+        temp.open(tempPath, mode | std::ios::trunc);
+        if (!temp) { failed = true; return; }
+        existing.clear();
+        existing.seekg(0);
+        for (uint64_t left = length; left > 0;) {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(left, CHUNK));
+            if (!existing.read(chunk.get(), static_cast<std::streamsize>(n))) { failed = true; return; }
+            temp.write(chunk.get(), static_cast<std::streamsize>(n));
+            left -= n;
+        }
+        existing.close();
+    }
+
+public:
+    explicit AtomicFile(std::string target, std::ios::openmode m = std::ios::out, PublishTally* t = nullptr)
+        : path(std::move(target)), tempPath(path + ".tmp"), mode(m | std::ios::out), tally(t),
+          existing(path, (m & std::ios::binary) | std::ios::in), chunk(new char[CHUNK]) {
+        if (!existing) Diverge();
+    }
+    ~AtomicFile() { Abandon(); }
+    AtomicFile(const AtomicFile&) = delete;
+    AtomicFile& operator=(const AtomicFile&) = delete;
+
+    // False once the replacement can no longer be written
+    explicit operator bool() const { return !failed; }
+
+    void Write(std::string_view data) {
+        if (failed || outcome != Outcome::Pending) return;
+        if (diverged) {
+            temp.write(data.data(), static_cast<std::streamsize>(data.size()));
+            length += data.size();
+            return;
+        }
+        for (size_t off = 0; off < data.size(); off += CHUNK) {
+            size_t n = std::min(CHUNK, data.size() - off);
+            existing.read(chunk.get(), static_cast<std::streamsize>(n));
+            if (static_cast<size_t>(existing.gcount()) != n || std::memcmp(chunk.get(), data.data() + off, n) != 0) {
+                Diverge();
+                return Write(data.substr(off));
+            }
+            length += n;
+        }
+    }
+
+    // Drop the replacement; the existing file stays as it was. No effect once committed
+    void Abandon() {
+        if (outcome != Outcome::Pending) return;
+        existing.close();
+        temp.close();
+        std::error_code ec;
+        if (diverged) fs::remove(tempPath, ec);
+        failed = true;
+        outcome = Outcome::Failed;
+    }
+
+    Outcome Commit() {
+        if (outcome != Outcome::Pending) return outcome;
+        // Everything matched so far: unchanged unless the old file is longer
+        if (!diverged && !failed) {
+            if (existing.peek() == std::char_traits<char>::eof()) {
+                existing.close();
+                if (tally) tally->unchanged++;
+                return outcome = Outcome::Unchanged;
+            }
+            Diverge();
+        }
+        existing.close();
+        temp.close();
+        std::error_code ec;
+        if (!failed && !temp.fail()) fs::rename(tempPath, path, ec);
+        if (failed || temp.fail() || ec) {
+            fs::remove(tempPath, ec);
+            return outcome = Outcome::Failed;
+        }
+        if (tally) tally->replaced++;
+        return outcome = Outcome::Replaced;
+    }
+};
+
+// Receives every block a BufferedWriter flushes, e.g. a compressed sibling file
+class BlockSink {
+public:
+    virtual ~BlockSink() = default;
+    virtual void Write(std::string_view block) = 0;
+    virtual void Finish() = 0;
+};
+
+// Buffered text writer shared by all exporters. Numbers are formatted with
+// std::to_chars (no stream state, no temporary strings) and text reaches the
+// underlying stream in 64 KB blocks, or is appended to a string target.
+class BufferedWriter {
+    static constexpr size_t CAPACITY = 1 << 16;
+    std::unique_ptr<AtomicFile> file;
+    std::ostream* out = nullptr;
+    std::string* target = nullptr;    // String mode: appends directly, no block buffer
+    std::unique_ptr<char[]> buf;
+    size_t used = 0;
+    std::vector<std::unique_ptr<BlockSink>> sinks;
+
+    template <typename... Args>
+    BufferedWriter& Chars(Args... args) {
+        char tmp[400]; // Fits any fixed-format double at precision <= 60
+        auto res = std::to_chars(tmp, tmp + sizeof tmp, args...);
+        return Put(std::string_view(tmp, res.ec == std::errc() ? static_cast<size_t>(res.ptr - tmp) : 0));
+    }
+
+    void Emit(std::string_view block) {
+        if (file) file->Write(block);
+        else out->write(block.data(), static_cast<std::streamsize>(block.size()));
+        for (auto& sink : sinks) sink->Write(block);
+    }
+
+    // True when any byte of `s` is , " \r or \n. Scans eight bytes per step
+    // with the classic has-zero-byte trick.
+    static bool NeedsQuoting(std::string_view s) {
+        constexpr uint64_t ONES = 0x0101010101010101ull, HIGHS = 0x8080808080808080ull;
+        auto has = [](uint64_t w, unsigned char c) {
+            uint64_t x = w ^ (ONES * c);
+            return ((x - ONES) & ~x & HIGHS) != 0;
+        };
+        size_t i = 0;
+        for (; i + 8 <= s.size(); i += 8) {
+            uint64_t w;
+            std::memcpy(&w, s.data() + i, 8);
+            if (has(w, ',') | has(w, '"') | has(w, '\n') | has(w, '\r')) return true;
+        }
+        for (; i < s.size(); ++i) {
+            char c = s[i];
+            if (c == ',' || c == '"' || c == '\n' || c == '\r') return true;
+        }
+        return false;
+    }
+
+public:
+    // File mode: published through AtomicFile, so an unchanged file is never rewritten
+    explicit BufferedWriter(const std::string& path, std::ios::openmode mode = std::ios::out, PublishTally* tally = nullptr)
+        : file(std::make_unique<AtomicFile>(path, mode, tally)), buf(new char[CAPACITY]) {}
+    explicit BufferedWriter(std::ostream& os) : out(&os), buf(new char[CAPACITY]) {}
+    // String mode; a pointer so a std::string path never selects it by accident
+    explicit BufferedWriter(std::string* str) : target(str) {}
+    // A file writer is only published by Close(); destroyed before that, e.g.
+    // while unwinding from an exception, it leaves the previous file in place
+    ~BufferedWriter() {
+        if (file) Abandon();
+        else Close();
+    }
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    explicit operator bool() const { return target || (file ? static_cast<bool>(*file) : static_cast<bool>(*out)); }
+
+    void Flush() {
+        if (used) Emit(std::string_view(buf.get(), used));
+        used = 0;
+    }
+
+    // Flush, finish the sinks and publish the file; false if it could not be
+    // written (the previous version, if any, is left in place). Idempotent.
+    bool Close() {
+        Flush();
+        for (auto& sink : sinks) sink->Finish();
+        sinks.clear();
+        if (file) return file->Commit() != AtomicFile::Outcome::Failed;
+        return target || static_cast<bool>(*out);
+    }
+
+    // Drop everything written, sibling files included; the previous files stay
+    void Abandon() {
+        used = 0;
+        sinks.clear();
+        if (file) file->Abandon();
+    }
+
+    // Feed everything written from here on into `sink` as well; finished by Close()
+    void AddSink(std::unique_ptr<BlockSink> sink) {
+        Flush();
+        sinks.push_back(std::move(sink));
+    }
+
+    BufferedWriter& Put(std::string_view s) {
+        if (target) {
+            target->append(s);
+            return *this;
+        }
+        if (s.size() > CAPACITY - used) {
+            Flush();
+            if (s.size() >= CAPACITY) {
+                Emit(s);
+                return *this;
+            }
+        }
+        std::memcpy(buf.get() + used, s.data(), s.size());
+        used += s.size();
+        return *this;
+    }
+    BufferedWriter& Put(char c) {
+        if (target) {
+            target->push_back(c);
+            return *this;
+        }
+        if (used == CAPACITY) Flush();
+        buf[used++] = c;
+        return *this;
+    }
+
+    // Native byte image of a trivially copyable value (binary outputs)
+    template <typename T>
+    BufferedWriter& Raw(const T& v) {
+        static_assert(std::is_trivially_copyable_v<T>, "Raw writes object bytes");
+        return Put(std::string_view(reinterpret_cast<const char*>(&v), sizeof v));
+    }
+
+    BufferedWriter& Integer(long long v) { return Chars(v); }
+    // printf("%.*f") equivalent
+    BufferedWriter& Fixed(double v, int precision) { return Chars(v, std::chars_format::fixed, precision); }
+    // printf("%.*g") equivalent; precision 6 matches an unconfigured ostream
+    BufferedWriter& General(double v, int precision = 6) { return Chars(v, std::chars_format::general, precision); }
+    // Shortest text that parses back to exactly `v`
+    BufferedWriter& Shortest(double v) { return Chars(v); }
+
+    // RFC 4180 field: quoted only when needed, embedded quotes doubled
+    BufferedWriter& CsvField(std::string_view s) {
+        if (!NeedsQuoting(s)) return Put(s);
+        Put('"');
+        size_t pos = 0;
+        for (size_t q; (q = s.find('"', pos)) != std::string_view::npos; pos = q + 1) {
+            Put(s.substr(pos, q + 1 - pos)).Put('"');
+        }
+        return Put(s.substr(pos)).Put('"');
+    }
+
+    // JSON string literal, escaped the way nlohmann::json::dump() does
+    BufferedWriter& JsonString(std::string_view s) {
+        static const char HEX[] = "0123456789abcdef";
+        Put('"');
+        size_t run = 0;
+        for (size_t i = 0; i < s.size(); ++i) {
+            unsigned char c = static_cast<unsigned char>(s[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') continue;
+            Put(s.substr(run, i - run));
+            run = i + 1;
+            switch (c) {
+                case '"':  Put("\\\""); break;
+                case '\\': Put("\\\\"); break;
+                case '\b': Put("\\b"); break;
+                case '\f': Put("\\f"); break;
+                case '\n': Put("\\n"); break;
+                case '\r': Put("\\r"); break;
+                case '\t': Put("\\t"); break;
+                default: {
+                    const char esc[] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+                    Put(std::string_view(esc, sizeof esc));
+                }
+            }
+        }
+        return Put(s.substr(run)).Put('"');
+    }
+
+    BufferedWriter& JsonBool(bool b) { return Put(b ? std::string_view("true") : std::string_view("false")); }
+
+    // HTML text or attribute value
+    BufferedWriter& Html(std::string_view s) {
+        size_t run = 0;
+        for (size_t i = 0; i < s.size(); ++i) {
+            std::string_view entity;
+            switch (s[i]) {
+                case '&':  entity = "&amp;"; break;
+                case '<':  entity = "&lt;"; break;
+                case '>':  entity = "&gt;"; break;
+                case '"':  entity = "&quot;"; break;
+                case '\'': entity = "&#39;"; break;
+                default: continue;
+            }
+            Put(s.substr(run, i - run)).Put(entity);
+            run = i + 1;
+        }
+        return Put(s.substr(run));
+    }
+
+    // Standard base64, padded
+    BufferedWriter& Base64(std::string_view bytes) {
+        static constexpr char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        char quad[4];
+        size_t i = 0;
+        for (; i + 3 <= bytes.size(); i += 3) {
+            uint32_t n = (uint32_t(uint8_t(bytes[i])) << 16) | (uint32_t(uint8_t(bytes[i + 1])) << 8) | uint8_t(bytes[i + 2]);
+            quad[0] = ALPHABET[n >> 18];
+            quad[1] = ALPHABET[(n >> 12) & 63];
+            quad[2] = ALPHABET[(n >> 6) & 63];
+            quad[3] = ALPHABET[n & 63];
+            Put(std::string_view(quad, 4));
+        }
+        if (i < bytes.size()) {
+            uint32_t n = uint32_t(uint8_t(bytes[i])) << 16;
+            if (i + 1 < bytes.size()) n |= uint32_t(uint8_t(bytes[i + 1])) << 8;
+            quad[0] = ALPHABET[n >> 18];
+            quad[1] = ALPHABET[(n >> 12) & 63];
+            quad[2] = i + 1 < bytes.size() ? ALPHABET[(n >> 6) & 63] : '=';
+            quad[3] = '=';
+            Put(std::string_view(quad, 4));
+        }
+        return *this;
+    }
+
+    // JavaScript's Number.prototype.toFixed(): Fixed(), except that exact ties
+    // round away from zero (printf rounds them to even), so server-rendered
+    // text matches what the page script would print
+    BufferedWriter& JsFixed(double v, int digits) {
+        if (!std::isfinite(v) || std::fabs(v) >= 1e21) return Shortest(v);
+        // Exact expansion well past the kept digits; buf[0] takes a carry out
+        char buf[128];
+        buf[0] = '0';
+        auto res = std::to_chars(buf + 1, buf + sizeof buf, std::fabs(v), std::chars_format::fixed, digits + 30);
+        char* point = std::find(buf + 1, res.ptr, '.');
+        char* end = point + 1 + digits;
+        if (*end >= '5') {
+            for (char* d = end - 1;; --d) {
+                if (*d == '.') continue;
+                if (*d != '9') { ++*d; break; }
+                *d = '0';
+            }
+        }
+        if (v < 0) Put('-');
+        const char* first = buf[0] == '0' ? buf + 1 : buf;
+        return Put(std::string_view(first, static_cast<size_t>((digits ? end : point) - first)));
+    }
+
+    // JSON number with the same text as nlohmann::json::dump(): shortest
+    // round-trip digits, a trailing ".0" on integral values, and exponent
+    // notation outside 1e-5 < |v| < 1e15. Non-finite values become null.
+    BufferedWriter& JsonNumber(double v) {
+        if (!std::isfinite(v)) return Put("null");
+        if (v == 0.0) return Put(std::signbit(v) ? "-0.0" : "0.0");
+        char sci[32];
+        auto res = std::to_chars(sci, sci + sizeof sci, v, std::chars_format::scientific);
+        std::string_view s(sci, static_cast<size_t>(res.ptr - sci));
+        if (s.front() == '-') { Put('-'); s.remove_prefix(1); }
+
+        // Digits without the point, and the decimal point position n (v = 0.digits * 10^n)
+        size_t e = s.find('e');
+        char digits[24];
+        int k = 0;
+        for (size_t i = 0; i < e; ++i) if (s[i] != '.') digits[k++] = s[i];
+        int exp10 = 0;
+        for (size_t i = e + 2; i < s.size(); ++i) exp10 = exp10 * 10 + (s[i] - '0');
+        if (s[e + 1] == '-') exp10 = -exp10;
+        const int n = exp10 + 1;
+        std::string_view all(digits, static_cast<size_t>(k));
+
+        if (k <= n && n <= 15) {
+            Put(all);
+            for (int z = k; z < n; ++z) Put('0');
+            return Put(".0");
+        }
+        if (0 < n && n <= 15) return Put(all.substr(0, n)).Put('.').Put(all.substr(n));
+        if (-4 < n && n <= 0) {
+            Put("0.");
+            for (int z = 0; z < -n; ++z) Put('0');
+            return Put(all);
+        }
+        Put(digits[0]);
+        if (k > 1) Put('.').Put(all.substr(1));
+        int x = n - 1;
+        Put('e').Put(x < 0 ? '-' : '+');
+        x = std::abs(x);
+        if (x < 10) Put('0');
+        return Integer(x);
+    }
+
+    // Stream-style chaining with ostream's default formatting
+    BufferedWriter& operator<<(std::string_view s) { return Put(s); }
+    BufferedWriter& operator<<(char c) { return Put(c); }
+    BufferedWriter& operator<<(double v) { return General(v); }
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    BufferedWriter& operator<<(T v) { return Integer(static_cast<long long>(v)); }
+};
+
+// --- Compressed Outputs ---
+// Streaming .gz/.zst siblings produced in the same pass as the plain file
+namespace Compression {
+#ifdef CROSSBENCH_ZLIB
+    class GzipSink : public BlockSink {
+        AtomicFile out;
+        z_stream zs{};
+        bool ok;
+        unsigned char chunk[1 << 16];
+
+        void Pump(std::string_view in, int flush) {
+            if (!ok) return;
+            zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+            zs.avail_in = static_cast<uInt>(in.size());
+            int rc;
+            do {
+                zs.next_out = chunk;
+                zs.avail_out = sizeof chunk;
+                rc = deflate(&zs, flush);
+                if (rc == Z_STREAM_ERROR) { ok = false; return; }
+                out.Write(std::string_view(reinterpret_cast<const char*>(chunk), sizeof chunk - zs.avail_out));
+            } while (flush == Z_FINISH ? rc != Z_STREAM_END : zs.avail_out == 0);
+        }
+
+    public:
+        GzipSink(const std::string& path, PublishTally* tally) : out(path, std::ios::binary, tally) {
+            // windowBits 15 + 16: gzip container instead of raw zlib
+            ok = out && deflateInit2(&zs, Config::GZIP_LEVEL, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        }
+        ~GzipSink() override { deflateEnd(&zs); }
+        void Write(std::string_view block) override { Pump(block, Z_NO_FLUSH); }
+        void Finish() override {
+            Pump({}, Z_FINISH);
+            if (!ok) out.Abandon();
+            out.Commit();
+        }
+    };
+#endif
+
+#ifdef CROSSBENCH_ZSTD
+    class ZstdSink : public BlockSink {
+        AtomicFile out;
+        ZSTD_CCtx* cctx;
+        std::vector<char> chunk;
+        bool ok;
+
+        void Pump(std::string_view in, ZSTD_EndDirective mode) {
+            if (!ok) return;
+            ZSTD_inBuffer input{in.data(), in.size(), 0};
+            bool done;
+            do {
+                ZSTD_outBuffer output{chunk.data(), chunk.size(), 0};
+                size_t remaining = ZSTD_compressStream2(cctx, &output, &input, mode);
+                if (ZSTD_isError(remaining)) { ok = false; return; }
+                out.Write(std::string_view(chunk.data(), output.pos));
+                done = (mode == ZSTD_e_end) ? remaining == 0 : input.pos == input.size;
+            } while (!done);
+        }
+
+    public:
+        ZstdSink(const std::string& path, PublishTally* tally)
+            : out(path, std::ios::binary, tally), cctx(ZSTD_createCCtx()), chunk(ZSTD_CStreamOutSize()) {
+            ok = out && cctx && !ZSTD_isError(ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, Config::ZSTD_LEVEL));
+        }
+        ~ZstdSink() override { ZSTD_freeCCtx(cctx); }
+        void Write(std::string_view block) override { Pump(block, ZSTD_e_continue); }
+        void Finish() override {
+            Pump({}, ZSTD_e_end);
+            if (!ok) out.Abandon();
+            out.Commit();
+        }
+    };
+#endif
+
+    // Formats compiled into this build, e.g. "gzip, zstd"; empty if none
+    inline std::string Available() {
+        std::string formats;
+#ifdef CROSSBENCH_ZLIB
+        formats += "gzip";
+#endif
+#ifdef CROSSBENCH_ZSTD
+        formats += formats.empty() ? "zstd" : ", zstd";
+#endif
+        return formats;
+    }
+
+    // Attach path.gz / path.zst siblings to `out` for every compiled-in format
+    inline void AttachSiblings(BufferedWriter& out, const std::string& path, PublishTally* tally = nullptr) {
+#ifdef CROSSBENCH_ZLIB
+        out.AddSink(std::make_unique<GzipSink>(path + ".gz", tally));
+#endif
+#ifdef CROSSBENCH_ZSTD
+        out.AddSink(std::make_unique<ZstdSink>(path + ".zst", tally));
+#endif
+        (void)out;
+        (void)path;
+        (void)tally;
+    }
+}
+
 // --- Domain Entities ---
 
 enum class Modality { Text, Image, Video };
@@ -148,6 +703,217 @@ struct RankScores {
     double enterprise = 0.0;
 };
 
+// --- Rank Dependency Graph ---
+// Explicit map of which RankScores fields read which inputs and weights, so a
+// change to one metric (or one weight) only recomputes the fields it feeds.
+enum class RankField : uint8_t { Overall, Value, Coding, Image, Video, Speed, Confidence, Enterprise, Count };
+
+enum class RankInput : uint8_t {
+    FinalScore, Reasoning, Coding, Creative, ContextWindow, Price, Speed,
+    UptimeSla, OrgMaturity, Modalities, Recency, Signals, EnterpriseFlag, OpenSourceFlag,
+    Confidence, // Derived node: recomputed from the inputs in CONFIDENCE_DEPS
+    Count
+};
+
+enum class WeightId : uint8_t {
+    OverallCore, OverallCoding, OverallCreative, OverallConfidence, OverallPrice,
+    ConfidenceBase, ConfidenceSignalBonus, ConfidenceRecencyBonus, ConfidenceVersatileBonus, ConfidenceVariancePenalty,
+    TieThreshold,
+    Count
+};
+
+using RankMask = uint16_t;
+using InputMask = uint32_t;
+
+constexpr size_t RANK_FIELD_COUNT = static_cast<size_t>(RankField::Count);
+constexpr RankMask ALL_RANK_FIELDS = static_cast<RankMask>((1u << RANK_FIELD_COUNT) - 1);
+
+constexpr RankMask FieldBit(RankField f) { return static_cast<RankMask>(1u << static_cast<unsigned>(f)); }
+constexpr InputMask InputBit(RankInput i) { return 1u << static_cast<unsigned>(i); }
+
+namespace RankGraph {
+    // Inputs that feed confidence_score (see ModelEntity::UpdateConfidence)
+    constexpr InputMask CONFIDENCE_DEPS = InputBit(RankInput::FinalScore) | InputBit(RankInput::Coding)
+        | InputBit(RankInput::Creative) | InputBit(RankInput::Modalities) | InputBit(RankInput::Recency)
+        | InputBit(RankInput::Signals) | InputBit(RankInput::EnterpriseFlag);
+
+    // Rank fields that read an input directly (see ModelEntity::ComputeRank)
+    constexpr RankMask FieldsOf(RankInput in) {
+        switch (in) {
+            case RankInput::FinalScore:    return FieldBit(RankField::Overall) | FieldBit(RankField::Value) | FieldBit(RankField::Image) | FieldBit(RankField::Video);
+            case RankInput::Reasoning:     return FieldBit(RankField::Coding);
+            case RankInput::Coding:        return FieldBit(RankField::Overall) | FieldBit(RankField::Coding);
+            case RankInput::Creative:      return FieldBit(RankField::Overall) | FieldBit(RankField::Image) | FieldBit(RankField::Video);
+            case RankInput::ContextWindow: return FieldBit(RankField::Coding);
+            case RankInput::Price:         return FieldBit(RankField::Overall) | FieldBit(RankField::Value) | FieldBit(RankField::Speed);
+            case RankInput::Speed:         return FieldBit(RankField::Image) | FieldBit(RankField::Video) | FieldBit(RankField::Speed);
+            case RankInput::UptimeSla:     return FieldBit(RankField::Enterprise);
+            case RankInput::OrgMaturity:   return FieldBit(RankField::Enterprise);
+            case RankInput::Modalities:    return FieldBit(RankField::Image) | FieldBit(RankField::Video);
+            case RankInput::Confidence:    return ALL_RANK_FIELDS & ~FieldBit(RankField::Value);
+            default:                       return 0; // Recency/Signals/flags only reach ranks through confidence or view filters
+        }
+    }
+
+    constexpr RankMask FieldsOf(InputMask inputs) {
+        RankMask out = 0;
+        for (unsigned i = 0; i < static_cast<unsigned>(RankInput::Count); ++i)
+            if (inputs & (1u << i)) out |= FieldsOf(static_cast<RankInput>(i));
+        return out;
+    }
+
+    // Rank fields that read a weight directly; confidence weights go through the derived node
+    constexpr RankMask FieldsOf(WeightId w) {
+        switch (w) {
+            case WeightId::OverallCore:
+            case WeightId::OverallCoding:
+            case WeightId::OverallCreative:
+            case WeightId::OverallConfidence:
+            case WeightId::OverallPrice:   return FieldBit(RankField::Overall);
+            default:                       return 0;
+        }
+    }
+
+    constexpr bool FeedsConfidence(WeightId w) {
+        return w >= WeightId::ConfidenceBase && w <= WeightId::ConfidenceVariancePenalty;
+    }
+
+    static_assert(FieldsOf(RankInput::Price) == (FieldBit(RankField::Overall) | FieldBit(RankField::Value) | FieldBit(RankField::Speed)),
+                  "A price change must touch overall/value/speed only");
+}
+
+inline double& RankValue(RankScores& r, RankField f) {
+    switch (f) {
+        case RankField::Overall:    return r.overall;
+        case RankField::Value:      return r.value;
+        case RankField::Coding:     return r.coding;
+        case RankField::Image:      return r.image;
+        case RankField::Video:      return r.video;
+        case RankField::Speed:      return r.speed;
+        case RankField::Confidence: return r.confidence;
+        default:                    return r.enterprise;
+    }
+}
+
+inline double RankValue(const RankScores& r, RankField f) {
+    return RankValue(const_cast<RankScores&>(r), f);
+}
+
+// --- Weight Profiles ---
+// The shipped profile exposes every weight as a static constexpr member, so the
+// ranking kernel instantiated on it constant-folds them. RuntimeWeightProfile
+// has the same member names as plain doubles and is loaded from JSON
+// (--weights <file>); the same kernel template then reads them at runtime.
+struct DefaultWeightProfile {
+    static constexpr double overall_core = Config::Weights::OVERALL_CORE;
+    static constexpr double overall_coding = Config::Weights::OVERALL_CODING;
+    static constexpr double overall_creative = Config::Weights::OVERALL_CREATIVE;
+    static constexpr double overall_confidence = Config::Weights::OVERALL_CONFIDENCE;
+    static constexpr double overall_price = Config::Weights::OVERALL_PRICE;
+
+    static constexpr double confidence_base = Config::Weights::CONFIDENCE_BASE;
+    static constexpr double confidence_signal_bonus = Config::Weights::CONFIDENCE_SIGNAL_BONUS;
+    static constexpr double confidence_recency_bonus = Config::Weights::CONFIDENCE_RECENCY_BONUS;
+    static constexpr double confidence_versatile_bonus = Config::Weights::CONFIDENCE_VERSATILE_BONUS;
+    static constexpr double confidence_variance_penalty = Config::Weights::CONFIDENCE_VARIANCE_PENALTY;
+
+    static constexpr double tie_threshold = Config::Weights::TIE_THRESHOLD;
+};
+
+struct RuntimeWeightProfile {
+    double overall_core = DefaultWeightProfile::overall_core;
+    double overall_coding = DefaultWeightProfile::overall_coding;
+    double overall_creative = DefaultWeightProfile::overall_creative;
+    double overall_confidence = DefaultWeightProfile::overall_confidence;
+    double overall_price = DefaultWeightProfile::overall_price;
+
+    double confidence_base = DefaultWeightProfile::confidence_base;
+    double confidence_signal_bonus = DefaultWeightProfile::confidence_signal_bonus;
+    double confidence_recency_bonus = DefaultWeightProfile::confidence_recency_bonus;
+    double confidence_versatile_bonus = DefaultWeightProfile::confidence_versatile_bonus;
+    double confidence_variance_penalty = DefaultWeightProfile::confidence_variance_penalty;
+
+    double tie_threshold = DefaultWeightProfile::tie_threshold;
+
+    struct Entry {
+        WeightId id;
+        const char* key;  // JSON key in a profile file
+        double RuntimeWeightProfile::* member;
+    };
+    static const std::array<Entry, static_cast<size_t>(WeightId::Count)> ENTRIES;
+
+    double Get(WeightId id) const { return this->*ENTRIES[static_cast<size_t>(id)].member; }
+
+    // Loads a profile such as {"overall_core": 0.5, "overall_price": 0.05}.
+    // Missing keys keep their default; unknown keys are reported and ignored.
+    // A weight that is negative or not finite, or a tie_threshold that is not
+    // above zero, rejects the whole profile: Views::TieBucket divides by it.
+    static std::optional<RuntimeWeightProfile> Load(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) return std::nullopt;
+        RuntimeWeightProfile p;
+        try {
+            json j = json::parse(in);
+            if (!j.is_object()) return std::nullopt;
+            for (const auto& [key, value] : j.items()) {
+                auto it = std::find_if(ENTRIES.begin(), ENTRIES.end(), [&](const Entry& e) { return key == e.key; });
+                if (it == ENTRIES.end() || !value.is_number()) {
+                    std::cout << Utils::YELLOW << "[Weights] Ignoring '" << key << "' in " << path << Utils::RESET << std::endl;
+                    continue;
+                }
+                p.*(it->member) = value.get<double>();
+            }
+        } catch (const json::exception&) {
+            return std::nullopt;
+        }
+        for (const Entry& e : ENTRIES) {
+            double v = p.*(e.member);
+            bool valid = std::isfinite(v) && (e.id == WeightId::TieThreshold ? v > 0.0 : v >= 0.0);
+            if (valid) continue;
+            std::cout << Utils::RED << "[Weights] '" << e.key << "' in " << path << " must be "
+                      << (e.id == WeightId::TieThreshold ? "above zero" : "zero or more") << ", got " << v << Utils::RESET << std::endl;
+            return std::nullopt;
+        }
+        double overall = p.overall_core + p.overall_coding + p.overall_creative + p.overall_confidence + p.overall_price;
+        if (std::abs(overall - 1.0) > 1e-6) {
+            std::cout << Utils::YELLOW << "[Weights] Overall weights sum to " << overall 
+                      << " (Overall scores will not be on a 0-100 scale)" << Utils::RESET << std::endl;
+        }
+        return p;
+    }
+};
+
+const std::array<RuntimeWeightProfile::Entry, static_cast<size_t>(WeightId::Count)> RuntimeWeightProfile::ENTRIES = {{
+    {WeightId::OverallCore,               "overall_core",                &RuntimeWeightProfile::overall_core},
+    {WeightId::OverallCoding,             "overall_coding",              &RuntimeWeightProfile::overall_coding},
+    {WeightId::OverallCreative,           "overall_creative",            &RuntimeWeightProfile::overall_creative},
+    {WeightId::OverallConfidence,         "overall_confidence",          &RuntimeWeightProfile::overall_confidence},
+    {WeightId::OverallPrice,              "overall_price",               &RuntimeWeightProfile::overall_price},
+    {WeightId::ConfidenceBase,            "confidence_base",             &RuntimeWeightProfile::confidence_base},
+    {WeightId::ConfidenceSignalBonus,     "confidence_signal_bonus",     &RuntimeWeightProfile::confidence_signal_bonus},
+    {WeightId::ConfidenceRecencyBonus,    "confidence_recency_bonus",    &RuntimeWeightProfile::confidence_recency_bonus},
+    {WeightId::ConfidenceVersatileBonus,  "confidence_versatile_bonus",  &RuntimeWeightProfile::confidence_versatile_bonus},
+    {WeightId::ConfidenceVariancePenalty, "confidence_variance_penalty", &RuntimeWeightProfile::confidence_variance_penalty},
+    {WeightId::TieThreshold,              "tie_threshold",               &RuntimeWeightProfile::tie_threshold}
+}};
+
+// Flat copy of everything the rank kernel reads, so batch callers can run it
+// on perturbed values without touching a ModelEntity
+struct RankInputs {
+    double final_score = 0.0;
+    double reasoning_score = 0.0;
+    double coding_score = 0.0;
+    double creative_score = 0.0;
+    double context_window = 0.0;
+    double price_input_1m = 0.0;
+    double tokens_per_sec = 0.0;
+    double confidence_score = 0.0;
+    double uptime_sla = 0.0;
+    double org_maturity = 0.0;
+    bool has_image = false;
+    bool has_video = false;
+};
+
 struct Signal {
     std::string source;
     double score;
@@ -172,11 +938,18 @@ public:
     double confidence_score = 0.0;
     std::string confidence_reason;
     
-    ModelEntity(std::string n, std::string o) : name(n), organization(o) {}
+    ModelEntity(std::string n, std::string o) : name(std::move(n)), organization(std::move(o)) {}
+
+    // Entities are owned by the registry and only ever moved into it; a copy
+    // would duplicate every string, the modality set and the signal list.
+    ModelEntity(const ModelEntity&) = delete;
+    ModelEntity& operator=(const ModelEntity&) = delete;
+    ModelEntity(ModelEntity&&) noexcept = default;
+    ModelEntity& operator=(ModelEntity&&) noexcept = default;
 
-    void AddSignal(const std::string& source, double score, double weight) {
+    void AddSignal(std::string source, double score, double weight) {
         if (score > 0.0) {
-            signals.push_back({source, std::clamp(score, 0.0, 1.0), weight});
+            signals.push_back({std::move(source), std::clamp(score, 0.0, 1.0), weight});
         }
     }
 
@@ -184,17 +957,15 @@ public:
         if (!signals.empty()) {
             double weighted_sum = 0.0;
             double total_weight = 0.0;
-            std::vector<double> scores;
 
             for (const auto& s : signals) {
                 weighted_sum += s.score * s.weight;
                 total_weight += s.weight;
-                scores.push_back(s.score);
             }
 
             final_score = (total_weight > 0) ? (weighted_sum / total_weight) : 0.0;
             // Log score aggregation for debugging
-            if (final_score > 0.9 || final_score < 0.1) {
+            if (log_details && (final_score > 0.9 || final_score < 0.1)) {
                 std::cout << Utils::YELLOW << "  [Aggregate] " << name << ": score=" 
                           << std::fixed << std::setprecision(3) << final_score 
                           << " (" << signals.size() << " signals)" << Utils::RESET << std::endl;
@@ -211,55 +982,30 @@ public:
         else metrics.recency_bonus = 0;
     }
     
-    void RecalculateConfidence() {
+    // When false, suppresses the per-model diagnostics below (used by --bench)
+    static inline bool log_details = true;
+
+    template <typename Profile = DefaultWeightProfile>
+    void RecalculateConfidence(const Profile& w = Profile{}) {
+        UpdateConfidence(w);
+        ComputeRankings(w);
+    }
+
+    template <typename Profile = DefaultWeightProfile>
+    void UpdateConfidence(const Profile& w = Profile{}) {
         // Recalculate confidence after metrics are enriched
         confidence_reason = ""; // Reset reason string
         
         if (!signals.empty()) {
-            double conf = Config::Weights::CONFIDENCE_BASE;
-            
-            // Signal count bonus
-            conf += (signals.size() * Config::Weights::CONFIDENCE_SIGNAL_BONUS);
-            
-            // Recency bonus
-            if (metrics.last_updated_days_ago <= 30) {
-                conf += Config::Weights::CONFIDENCE_RECENCY_BONUS;
-                confidence_reason += "Recent Verification, ";
-            } else if (metrics.last_updated_days_ago <= 90) {
-                conf += Config::Weights::CONFIDENCE_RECENCY_BONUS * 0.5;
-            }
-            
-            // Versatility bonus (multimodal or excellent at multiple tasks)
-            bool is_versatile = (metrics.coding_score > 0.75 && metrics.creative_score > 0.75) || (modalities.size() > 1);
-            if (is_versatile) {
-                conf += Config::Weights::CONFIDENCE_VERSATILE_BONUS;
-                confidence_reason += "Multi-Category Verified, ";
-            }
-            
-            // Score quality bonus (higher scores = more confidence)
-            if (final_score > 0.85) conf += 15.0;
-            else if (final_score > 0.75) conf += 10.0;
-            else if (final_score > 0.65) conf += 5.0;
-            else if (final_score < 0.40) conf -= 10.0; // Penalty for low scores
-
-            // Variance calculation
-            std::vector<double> scores;
-            for (const auto& s : signals) scores.push_back(s.score);
-            double mean = final_score;
-            double sq_sum = std::inner_product(scores.begin(), scores.end(), scores.begin(), 0.0,
-                std::plus<double>(), [mean](double x, double y) { return (x - mean) * (y - mean); });
-            double variance = (scores.size() > 1) ? std::sqrt(sq_sum / scores.size()) : 0.0;
-            
-            conf -= (variance * Config::Weights::CONFIDENCE_VARIANCE_PENALTY);
-            
-            // Enterprise readiness bonus
-            if (metrics.is_enterprise_ready) conf += 5.0;
-            
+            bool is_versatile = IsVersatile(metrics.coding_score, metrics.creative_score, modalities.size() > 1);
+            if (metrics.last_updated_days_ago <= 30) confidence_reason += "Recent Verification, ";
+            if (is_versatile) confidence_reason += "Multi-Category Verified, ";
             if (signals.size() >= 3) confidence_reason += "High Consensus";
             
-            confidence_score = std::clamp(conf, 10.0, 99.0);
+            confidence_score = ConfidenceKernel(signals.size(), [&](size_t i) { return signals[i].score; }, final_score,
+                                                metrics.last_updated_days_ago, is_versatile, metrics.is_enterprise_ready, w);
             // Log confidence calculation
-            if (confidence_score < 20.0 || confidence_score > 90.0) {
+            if (log_details && (confidence_score < 20.0 || confidence_score > 90.0)) {
                 std::cout << Utils::YELLOW << "  [Confidence] " << name << ": " 
                           << std::fixed << std::setprecision(1) << confidence_score 
                           << "% (" << confidence_reason << ")" << Utils::RESET << std::endl;
@@ -267,109 +1013,227 @@ public:
         } else {
             confidence_score = 10.0;
         }
+    }
+
+    // Versatility (multimodal or excellent at multiple tasks)
+    static bool IsVersatile(double coding_score, double creative_score, bool multimodal) {
+        return (coding_score > 0.75 && creative_score > 0.75) || multimodal;
+    }
+
+    // Confidence from `count` signal scores (score_at(i)); allocation-free so
+    // batch callers such as the resampler can run it per iteration.
+    template <typename ScoreAt, typename Profile>
+    static double ConfidenceKernel(size_t count, ScoreAt score_at, double final_score, int days_ago,
+                                   bool is_versatile, bool is_enterprise_ready, const Profile& w) {
+        if (count == 0) return 10.0;
+        double conf = w.confidence_base;
+        
+        // Signal count bonus
+        conf += (count * w.confidence_signal_bonus);
+        
+        // Recency bonus
+        if (days_ago <= 30) conf += w.confidence_recency_bonus;
+        else if (days_ago <= 90) conf += w.confidence_recency_bonus * 0.5;
+        
+        // Versatility bonus
+        if (is_versatile) conf += w.confidence_versatile_bonus;
+        
+        // Score quality bonus (higher scores = more confidence)
+        if (final_score > 0.85) conf += 15.0;
+        else if (final_score > 0.75) conf += 10.0;
+        else if (final_score > 0.65) conf += 5.0;
+        else if (final_score < 0.40) conf -= 10.0; // Penalty for low scores
+
+        // Variance calculation
+        double sq_sum = 0.0;
+        for (size_t i = 0; i < count; ++i) sq_sum += (score_at(i) - final_score) * (score_at(i) - final_score);
+        double variance = (count > 1) ? std::sqrt(sq_sum / count) : 0.0;
+        
+        conf -= (variance * w.confidence_variance_penalty);
         
-        ComputeRankings();
+        // Enterprise readiness bonus
+        if (is_enterprise_ready) conf += 5.0;
+        
+        return std::clamp(conf, 10.0, 99.0);
+    }
+
+    RankInputs Inputs() const {
+        RankInputs in;
+        in.final_score = final_score;
+        in.reasoning_score = metrics.reasoning_score;
+        in.coding_score = metrics.coding_score;
+        in.creative_score = metrics.creative_score;
+        in.context_window = metrics.context_window;
+        in.price_input_1m = metrics.price_input_1m;
+        in.tokens_per_sec = metrics.tokens_per_sec;
+        in.confidence_score = confidence_score;
+        in.uptime_sla = metrics.uptime_sla;
+        in.org_maturity = metrics.org_maturity;
+        in.has_image = modalities.count(Modality::Image) > 0;
+        in.has_video = modalities.count(Modality::Video) > 0;
+        return in;
+    }
+
+    template <typename Profile = DefaultWeightProfile>
+    void ComputeRankings(const Profile& w = Profile{}) {
+        ComputeRanks(ALL_RANK_FIELDS, w);
+    }
+
+    // Recompute only the fields in `fields` (see RankGraph for what each one reads)
+    template <typename Profile = DefaultWeightProfile>
+    void ComputeRanks(RankMask fields, const Profile& w = Profile{}) {
+        RankKernel(Inputs(), fields, ranks, w);
     }
 
-    void ComputeRankings() {
-        double conf_factor = confidence_score / 100.0;
+    template <typename Profile>
+    static void RankKernel(const RankInputs& in, RankMask fields, RankScores& ranks, const Profile& w) {
+        double conf_factor = in.confidence_score / 100.0;
+        double price_factor = 1.0 / (1.0 + in.price_input_1m / 10.0);
+        double speed_norm = std::clamp(in.tokens_per_sec / 150.0, 0.0, 1.0); 
         
         // 1. Overall (Fixed: no double-counting, better price normalization)
         // Scale to 100 for display consistency
-        double price_factor = 1.0 / (1.0 + metrics.price_input_1m / 10.0);
-        ranks.overall = ((final_score * Config::Weights::OVERALL_CORE) 
-                      + (metrics.coding_score * Config::Weights::OVERALL_CODING) 
-                      + (metrics.creative_score * Config::Weights::OVERALL_CREATIVE) 
-                      + (conf_factor * Config::Weights::OVERALL_CONFIDENCE) 
-                      + (price_factor * Config::Weights::OVERALL_PRICE)) * 100.0;
+        if (fields & FieldBit(RankField::Overall)) {
+            ranks.overall = ((in.final_score * w.overall_core) 
+                          + (in.coding_score * w.overall_coding) 
+                          + (in.creative_score * w.overall_creative) 
+                          + (conf_factor * w.overall_confidence) 
+                          + (price_factor * w.overall_price)) * 100.0;
+        }
 
         // 2. Value (Fixed: quadratic score scaling rewards excellence without penalizing high performers)
-        if (metrics.price_input_1m <= 0.0) {
-            ranks.value = final_score * 1000.0; // Free models get bonus
-        } else {
-            double log_price = std::log10(metrics.price_input_1m + 1.0);
-            ranks.value = (final_score * final_score) / (log_price + 0.1);
+        if (fields & FieldBit(RankField::Value)) {
+            if (in.price_input_1m <= 0.0) {
+                ranks.value = in.final_score * 1000.0; // Free models get bonus
+            } else {
+                double log_price = std::log10(in.price_input_1m + 1.0);
+                ranks.value = (in.final_score * in.final_score) / (log_price + 0.1);
+            }
         }
 
         // 3. Coding (Fixed: normalize context window to [0,1], scale to 100)
-        double ctx_norm = std::clamp(metrics.context_window / 200000.0, 0.0, 1.0);
-        ranks.coding = ((metrics.coding_score * 0.6) 
-                     + (metrics.reasoning_score * 0.2) 
-                     + (ctx_norm * 0.1) 
-                     + (conf_factor * 0.1)) * 100.0;
+        if (fields & FieldBit(RankField::Coding)) {
+            double ctx_norm = std::clamp(in.context_window / 200000.0, 0.0, 1.0);
+            ranks.coding = ((in.coding_score * 0.6) 
+                         + (in.reasoning_score * 0.2) 
+                         + (ctx_norm * 0.1) 
+                         + (conf_factor * 0.1)) * 100.0;
+        }
 
         // 4. Image (Fixed: add final_score component for generation quality, scale to 100)
-        double speed_norm = std::clamp(metrics.tokens_per_sec / 150.0, 0.0, 1.0); 
-        ranks.image = ((final_score * 0.5) + (metrics.creative_score * 0.3) 
-                    + (speed_norm * 0.1) + (conf_factor * 0.1)) * 100.0;
-        if (modalities.count(Modality::Image) == 0) ranks.image = 0.0;
+        if (fields & FieldBit(RankField::Image)) {
+            ranks.image = ((in.final_score * 0.5) + (in.creative_score * 0.3) 
+                        + (speed_norm * 0.1) + (conf_factor * 0.1)) * 100.0;
+            if (!in.has_image) ranks.image = 0.0;
+        }
 
         // 5. Video (Fixed: add final_score component for generation quality, scale to 100)
-        ranks.video = ((final_score * 0.5) + (metrics.creative_score * 0.3) 
-                    + (conf_factor * 0.1) + (speed_norm * 0.1)) * 100.0;
-        // Reduce score for non-video models instead of zeroing (keep multimodal LLMs visible)
-        if (modalities.count(Modality::Video) == 0) {
-            ranks.video *= 0.3; // 30% score for models without native video support
+        if (fields & FieldBit(RankField::Video)) {
+            ranks.video = ((in.final_score * 0.5) + (in.creative_score * 0.3) 
+                        + (conf_factor * 0.1) + (speed_norm * 0.1)) * 100.0;
+            // Reduce score for non-video models instead of zeroing (keep multimodal LLMs visible)
+            if (!in.has_video) {
+                ranks.video *= 0.3; // 30% score for models without native video support
+            }
         }
 
         // 6. Speed (Normalized to 0-100 scale based on tokens/sec performance)
         // Normalize assuming 200 tokens/sec is excellent (100 points)
-        double speed_base = std::clamp(metrics.tokens_per_sec / 200.0, 0.0, 1.0);
-        // Factor in confidence and efficiency
-        ranks.speed = ((speed_base * 0.7) + (conf_factor * 0.2) + (price_factor * 0.1)) * 100.0;
+        if (fields & FieldBit(RankField::Speed)) {
+            double speed_base = std::clamp(in.tokens_per_sec / 200.0, 0.0, 1.0);
+            // Factor in confidence and efficiency
+            ranks.speed = ((speed_base * 0.7) + (conf_factor * 0.2) + (price_factor * 0.1)) * 100.0;
+        }
 
         // 7. Confidence
-        ranks.confidence = confidence_score;
+        if (fields & FieldBit(RankField::Confidence)) {
+            ranks.confidence = in.confidence_score;
+        }
 
         // 8. Enterprise (scale to 100)
-        ranks.enterprise = ((conf_factor * 0.4) 
-                         + (metrics.uptime_sla * 0.3) 
-                         + (metrics.org_maturity * 0.3)) * 100.0;
+        if (fields & FieldBit(RankField::Enterprise)) {
+            ranks.enterprise = ((conf_factor * 0.4) 
+                             + (in.uptime_sla * 0.3) 
+                             + (in.org_maturity * 0.3)) * 100.0;
+        }
     }
     
-    json ToJSON() const {
-        // Determine primary type for display
-        std::string primary_type = "Text";
-        if (modalities.count(Modality::Video) > 0) primary_type = "Video";
-        else if (modalities.count(Modality::Image) > 0 && modalities.size() == 1) primary_type = "Image";
-        else if (modalities.size() > 1) primary_type = "Multimodal";
-        
-        return {
-            {"name", name},
-            {"org", organization},
-            {"metrics", {
-                {"score", std::clamp(final_score * 100.0, 0.0, 100.0)}, // Normalize to 0-100
-                {"coding", std::clamp(metrics.coding_score * 100.0, 0.0, 100.0)},
-                {"creative", std::clamp(metrics.creative_score * 100.0, 0.0, 100.0)},
-                {"price", metrics.price_input_1m},
-                {"speed", metrics.tokens_per_sec},
-                {"recency_bonus", metrics.recency_bonus},
-                {"days_ago", metrics.last_updated_days_ago}
-            }},
-            {"ranks", {
-                {"overall", std::clamp(ranks.overall, 0.0, 100.0)},
-                {"value", std::clamp(ranks.value, 0.0, 100.0)},
-                {"coding", std::clamp(ranks.coding, 0.0, 100.0)},
-                {"image", std::clamp(ranks.image, 0.0, 100.0)},
-                {"video", std::clamp(ranks.video, 0.0, 100.0)},
-                {"speed", std::clamp(ranks.speed, 0.0, 100.0)},
-                {"confidence", std::clamp(ranks.confidence, 0.0, 100.0)},
-                {"enterprise", std::clamp(ranks.enterprise, 0.0, 100.0)}
-            }},
-            {"meta", {
-                {"confidence", confidence_score},
-                {"conf_reason", confidence_reason},
-                {"is_open_source", metrics.is_open_source},
-                {"is_enterprise", metrics.is_enterprise_ready},
-                {"is_image", modalities.count(Modality::Image) > 0},
-                {"is_video", modalities.count(Modality::Video) > 0},
-                {"is_text", modalities.count(Modality::Text) > 0},
-                {"primary_type", primary_type}
-            }}
+    // Determine primary type for display
+    std::string_view PrimaryType() const {
+        if (modalities.count(Modality::Video) > 0) return "Video";
+        if (modalities.count(Modality::Image) > 0 && modalities.size() == 1) return "Image";
+        if (modalities.size() > 1) return "Multimodal";
+        return "Text";
+    }
+
+    // Streams the export record. Keys are written in sorted order, the layout
+    // the dashboard and data/leaderboard_all.json have always had.
+    void WriteJSON(BufferedWriter& out) const {
+        auto pct = [](double v) { return std::clamp(v, 0.0, 100.0); };
+
+        out.Put("{\"meta\":{\"conf_reason\":").JsonString(confidence_reason)
+           .Put(",\"confidence\":").JsonNumber(confidence_score)
+           .Put(",\"is_enterprise\":").JsonBool(metrics.is_enterprise_ready)
+           .Put(",\"is_image\":").JsonBool(modalities.count(Modality::Image) > 0)
+           .Put(",\"is_open_source\":").JsonBool(metrics.is_open_source)
+           .Put(",\"is_text\":").JsonBool(modalities.count(Modality::Text) > 0)
+           .Put(",\"is_video\":").JsonBool(modalities.count(Modality::Video) > 0)
+           .Put(",\"primary_type\":").JsonString(PrimaryType());
+        out.Put("},\"metrics\":{\"coding\":").JsonNumber(pct(metrics.coding_score * 100.0))
+           .Put(",\"creative\":").JsonNumber(pct(metrics.creative_score * 100.0))
+           .Put(",\"days_ago\":").Integer(metrics.last_updated_days_ago)
+           .Put(",\"price\":").JsonNumber(metrics.price_input_1m)
+           .Put(",\"recency_bonus\":").Integer(metrics.recency_bonus)
+           .Put(",\"score\":").JsonNumber(pct(final_score * 100.0)) // Normalize to 0-100
+           .Put(",\"speed\":").JsonNumber(metrics.tokens_per_sec);
+        out.Put("},\"name\":").JsonString(name)
+           .Put(",\"org\":").JsonString(organization);
+        out.Put(",\"ranks\":{\"coding\":").JsonNumber(pct(ranks.coding))
+           .Put(",\"confidence\":").JsonNumber(pct(ranks.confidence))
+           .Put(",\"enterprise\":").JsonNumber(pct(ranks.enterprise))
+           .Put(",\"image\":").JsonNumber(pct(ranks.image))
+           .Put(",\"overall\":").JsonNumber(pct(ranks.overall))
+           .Put(",\"speed\":").JsonNumber(pct(ranks.speed))
+           .Put(",\"value\":").JsonNumber(pct(ranks.value))
+           .Put(",\"video\":").JsonNumber(pct(ranks.video))
+           .Put("}}");
+    }
+
+    // Hash of every field WriteJSON prints; keep the two in step
+    uint64_t OutputHash() const {
+        uint64_t h = Utils::FNV_OFFSET;
+        auto str = [&](const std::string& s) {
+            size_t n = s.size();
+            h = Utils::Fnv1a(&n, sizeof n, h);
+            h = Utils::Fnv1a(s.data(), n, h);
         };
+        auto pod = [&](const auto& v) { h = Utils::Fnv1a(&v, sizeof v, h); };
+        str(name);
+        str(organization);
+        str(confidence_reason);
+        pod(confidence_score);
+        pod(final_score);
+        pod(metrics.coding_score);
+        pod(metrics.creative_score);
+        pod(metrics.price_input_1m);
+        pod(metrics.tokens_per_sec);
+        pod(metrics.last_updated_days_ago);
+        pod(metrics.recency_bonus);
+        pod(metrics.is_open_source);
+        pod(metrics.is_enterprise_ready);
+        uint32_t modalityBits = 0;
+        for (Modality mod : modalities) modalityBits |= 1u << static_cast<unsigned>(mod);
+        pod(modalityBits);
+        for (size_t f = 0; f < RANK_FIELD_COUNT; ++f) pod(RankValue(ranks, static_cast<RankField>(f)));
+        return h;
     }
 };
 
+// The registry vector relocates entities on growth; keep that a move, never a copy
+static_assert(std::is_nothrow_move_constructible_v<ModelEntity>, "ModelEntity must relocate by move");
+static_assert(!std::is_copy_constructible_v<ModelEntity>, "ModelEntity must not be copied");
+static_assert(std::is_nothrow_move_constructible_v<Signal>, "Signal must relocate by move");
+
 // --- Networking ---
 class NetworkClient {
     class WinHttpHandle {
@@ -553,144 +1417,2393 @@ public:
     }
 };
 
-// --- Export System ---
-class DataExporter {
-    static std::string EscapeCSV(const std::string& s) {
-        if (s.find(',') != std::string::npos) return "\"" + s + "\"";
-        return s;
-    }
-public:
-    static void ExportJSON(const std::string& path, const std::string& jsonContent) {
-        std::ofstream out(path);
-        if (out) out << jsonContent;
-    }
-    static void ExportCSV(const std::string& path, const std::vector<ModelEntity>& models, const std::string& type) {
-        std::ofstream out(path);
-        if (!out) return;
-        
-        auto tieBreakerSort = [&](const ModelEntity& a, const ModelEntity& b, double scoreA, double scoreB) {
-            double diff = std::abs(scoreA - scoreB);
-            if (diff <= Config::Weights::TIE_THRESHOLD) return a.metrics.recency_bonus > b.metrics.recency_bonus;
-            return scoreA > scoreB;
-        };
+// --- Leaderboard Views ---
+// C++ mirror of the dashboard tabs (minus Ecosystem): which rank field each view
+// sorts on and which models it admits.
+enum class ViewId : uint8_t { Overall, Value, Coding, Image, Video, Speed, Confidence, Enterprise, OpenSource, Count };
 
-        if (type == "performance") {
-            out << "Rank,Model,Organization,GPQA Score,Input Price,Overall Score\n";
-            std::vector<ModelEntity> sorted = models;
-            std::sort(sorted.begin(), sorted.end(), [&](const ModelEntity& a, const ModelEntity& b){
-                return tieBreakerSort(a, b, a.ranks.overall, b.ranks.overall);
-            });
-            int rank = 1;
-            for (const auto& m : sorted) {
-                std::string price_str = (m.metrics.price_input_1m >= 999999.0) ? "N/A" : std::to_string(m.metrics.price_input_1m);
-                out << rank++ << "," << EscapeCSV(m.name) << "," << EscapeCSV(m.organization) << ","
-                    << std::fixed << std::setprecision(3) << m.final_score << ","
-                    << price_str << ","
-                    << std::fixed << std::setprecision(2) << m.ranks.overall << "\n";
-                if(rank > 100) break;
-            }
-        } else if (type == "price") {
-            out << "Rank,Model,Organization,GPQA Score,Input Price,Price\n";
-            std::vector<ModelEntity> sorted = models;
-            // Filter out models with unknown prices
-            sorted.erase(std::remove_if(sorted.begin(), sorted.end(), 
-                [](const ModelEntity& m) { return m.metrics.price_input_1m >= 999999.0; }), sorted.end());
-            std::sort(sorted.begin(), sorted.end(), [](const ModelEntity& a, const ModelEntity& b){
-                return a.metrics.price_input_1m < b.metrics.price_input_1m;
-            });
-            int rank = 1;
-            for (const auto& m : sorted) {
-                out << rank++ << "," << EscapeCSV(m.name) << "," << EscapeCSV(m.organization) << ","
-                    << std::fixed << std::setprecision(3) << m.final_score << ","
-                    << std::fixed << std::setprecision(2) << m.metrics.price_input_1m << ","
-                    << std::fixed << std::setprecision(2) << m.metrics.price_input_1m << "\n";
-                if(rank > 100) break;
-            }
-        } else if (type == "value") {
-            out << "Rank,Model,Organization,GPQA Score,Input Price,Value Score\n";
-            std::vector<ModelEntity> sorted = models;
-            // Filter out models with zero or negative value
-            sorted.erase(std::remove_if(sorted.begin(), sorted.end(), 
-                [](const ModelEntity& m) { return m.ranks.value <= 0.0; }), sorted.end());
-            std::sort(sorted.begin(), sorted.end(), [&](const ModelEntity& a, const ModelEntity& b){
-                return tieBreakerSort(a, b, a.ranks.value, b.ranks.value);
-            });
-            int rank = 1;
-            for (const auto& m : sorted) {
-                std::string price_str = (m.metrics.price_input_1m >= 999999.0) ? "N/A" : 
-                    (std::ostringstream() << std::fixed << std::setprecision(2) << m.metrics.price_input_1m).str();
-                out << rank++ << "," << EscapeCSV(m.name) << "," << EscapeCSV(m.organization) << ","
-                    << std::fixed << std::setprecision(3) << m.final_score << ","
-                    << price_str << ","
-                    << std::fixed << std::setprecision(2) << m.ranks.value << "\n";
-                if(rank > 100) break;
-            }
+constexpr size_t VIEW_COUNT = static_cast<size_t>(ViewId::Count);
+using ViewMask = uint16_t;
+constexpr ViewMask ALL_VIEWS = static_cast<ViewMask>((1u << VIEW_COUNT) - 1);
+
+struct ViewSpec {
+    const char* key;          // Matches the `views` keys in the dashboard script
+    RankField field;
+    InputMask filter_inputs;  // Inputs the admission filter reads
+    bool (*admits)(const ModelEntity&);
+};
+
+namespace Views {
+    const std::array<ViewSpec, VIEW_COUNT> ALL = {{
+        {"overall",    RankField::Overall,    InputBit(RankInput::Modalities),
+            [](const ModelEntity& m) { return m.modalities.count(Modality::Text) > 0; }},
+        {"value",      RankField::Value,      0,
+            [](const ModelEntity&) { return true; }},
+        {"coding",     RankField::Coding,     InputBit(RankInput::Coding),
+            [](const ModelEntity& m) { return m.metrics.coding_score > 0.0; }},
+        {"image",      RankField::Image,      InputBit(RankInput::Modalities),
+            [](const ModelEntity& m) { return m.modalities.count(Modality::Image) > 0; }},
+        {"video",      RankField::Video,      0,
+            [](const ModelEntity& m) { return m.ranks.video > 0.0; }},
+        {"speed",      RankField::Speed,      0,
+            [](const ModelEntity&) { return true; }},
+        {"conf",       RankField::Confidence, 0,
+            [](const ModelEntity&) { return true; }},
+        {"enterprise", RankField::Enterprise, InputBit(RankInput::EnterpriseFlag),
+            [](const ModelEntity& m) { return m.metrics.is_enterprise_ready; }},
+        {"opensource", RankField::Overall,    InputBit(RankInput::OpenSourceFlag),
+            [](const ModelEntity& m) { return m.metrics.is_open_source; }}
+    }};
+
+    inline const ViewSpec& Get(ViewId v) { return ALL[static_cast<size_t>(v)]; }
+
+    constexpr ViewMask ViewBit(ViewId v) { return static_cast<ViewMask>(1u << static_cast<unsigned>(v)); }
+
+    // Views whose ordering may move when `fields` are recomputed or `inputs` change
+    inline ViewMask Affected(RankMask fields, InputMask inputs) {
+        if (inputs & InputBit(RankInput::Recency)) return ALL_VIEWS; // Recency is the tie-breaker everywhere
+        ViewMask out = 0;
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            if ((fields & FieldBit(ALL[v].field)) || (inputs & ALL[v].filter_inputs)) out |= static_cast<ViewMask>(1u << v);
         }
+        return out;
     }
-    static void ExportLegacyText(const std::string& path, const std::vector<ModelEntity>& models) {
-        std::ofstream out(path);
-        out << "AI LEADERBOARD V8.5 (Fixed)\n------------------\n";
-        auto tieBreakerSort = [&](const ModelEntity& a, const ModelEntity& b, double scoreA, double scoreB) {
-            double diff = std::abs(scoreA - scoreB);
-            if (diff <= Config::Weights::TIE_THRESHOLD * 100.0) return a.metrics.recency_bonus > b.metrics.recency_bonus;
-            return scoreA > scoreB;
-        };
-        std::vector<ModelEntity> sorted = models;
-        std::sort(sorted.begin(), sorted.end(), [&](const ModelEntity& a, const ModelEntity& b){
-            return tieBreakerSort(a, b, a.ranks.overall * 100, b.ranks.overall * 100);
-        });
-        int rank = 1;
-        for (const auto& m : sorted) {
-            out << rank++ << ". " << m.name << " (" << m.ranks.overall*100 << ")\n";
-            if(rank > 50) break;
-        }
+
+    // Recency tie-breaker bucket. Scores are quantized into buckets of
+    // tie_threshold * 100 (0.5 points on the 0-100 scale by default) instead of
+    // comparing |a - b| <= threshold pairwise: that relation is not transitive,
+    // which std::sort does not allow.
+    inline int64_t TieBucket(double score, double tie_threshold) {
+        // Clamped so a tiny threshold cannot push the quotient past int64_t
+        constexpr double LIMIT = 4.0e18;
+        return static_cast<int64_t>(std::clamp(std::floor(score / (tie_threshold * 100.0)), -LIMIT, LIMIT));
     }
-};
+
+    // Within a bucket: fresher model first, then name (names are unique)
+    inline bool TieBreak(const ModelEntity& a, const ModelEntity& b) {
+        if (a.metrics.recency_bonus != b.metrics.recency_bonus) return a.metrics.recency_bonus > b.metrics.recency_bonus;
+        return a.name < b.name;
+    }
+
+    // The leaderboard ordering shared by every export and the dashboard:
+    // bucket descending, then TieBreak. A strict weak (in fact total) order.
+    inline bool Before(const ModelEntity& a, const ModelEntity& b, RankField field, double tie_threshold) {
+        int64_t ba = TieBucket(RankValue(a.ranks, field), tie_threshold);
+        int64_t bb = TieBucket(RankValue(b.ranks, field), tie_threshold);
+        if (ba != bb) return ba > bb;
+        return TieBreak(a, b);
+    }
+
+    // TieBreak position of each of `indices`, for batch callers that sort integer keys
+    inline std::vector<uint32_t> TieRanks(const std::vector<ModelEntity>& registry, const std::vector<size_t>& indices) {
+        std::vector<uint32_t> byTie(indices.size());
+        std::iota(byTie.begin(), byTie.end(), 0u);
+        std::sort(byTie.begin(), byTie.end(), [&](uint32_t a, uint32_t b) { return TieBreak(registry[indices[a]], registry[indices[b]]); });
+        std::vector<uint32_t> rank(indices.size());
+        for (uint32_t r = 0; r < byTie.size(); ++r) rank[byTie[r]] = r;
+        return rank;
+    }
+}
+
+// Ranked index lists over the registry. Each candidate is reduced to a compact
+// 16-byte key (primary order bits, name rank, registry index) and only the
+// top K are fully ordered, so callers iterate indices and never copy or
+// compare ModelEntity objects while sorting.
+class RankingIndex {
+    struct Key {
+        uint64_t primary;
+        uint32_t secondary;
+        uint32_t name_rank;
+        uint32_t index;
+        bool operator<(const Key& o) const {
+            if (primary != o.primary) return primary < o.primary;
+            if (secondary != o.secondary) return secondary < o.secondary;
+            if (name_rank != o.name_rank) return name_rank < o.name_rank;
+            return index < o.index;
+        }
+    };
+
+    const std::vector<ModelEntity>& registry;
+    std::vector<uint32_t> nameRank; // Position of each model in name order
+
+    // Order-preserving map of a double onto unsigned integers
+    static uint64_t OrderedBits(double d) {
+        uint64_t bits;
+        std::memcpy(&bits, &d, sizeof bits);
+        return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+    }
+
+    // Orders admitted models by primary(m), then secondary(m), then name
+    template <typename Admit, typename PrimaryFn, typename SecondaryFn>
+    std::vector<size_t> Select(size_t k, Admit&& admit, PrimaryFn&& primary, SecondaryFn&& secondary) const {
+        std::vector<Key> keys;
+        keys.reserve(registry.size());
+        for (uint32_t i = 0; i < registry.size(); ++i) {
+            if (admit(registry[i])) keys.push_back({primary(registry[i]), secondary(registry[i]), nameRank[i], i});
+        }
+        if (k == 0 || k >= keys.size()) {
+            std::sort(keys.begin(), keys.end());
+        } else {
+            std::partial_sort(keys.begin(), keys.begin() + k, keys.end());
+            keys.resize(k);
+        }
+        std::vector<size_t> out(keys.size());
+        for (size_t r = 0; r < keys.size(); ++r) out[r] = keys[r].index;
+        return out;
+    }
+
+public:
+    explicit RankingIndex(const std::vector<ModelEntity>& models) : registry(models), nameRank(models.size()) {
+        std::vector<uint32_t> byName(models.size());
+        std::iota(byName.begin(), byName.end(), 0u);
+        std::sort(byName.begin(), byName.end(), [&](uint32_t a, uint32_t b) { return models[a].name < models[b].name; });
+        for (uint32_t r = 0; r < byName.size(); ++r) nameRank[byName[r]] = r;
+    }
+
+    const std::vector<ModelEntity>& Registry() const { return registry; }
+
+    // Top `k` admitted models (k = 0: all) in Views::Before order on `field`
+    template <typename Admit>
+    std::vector<size_t> Top(RankField field, double tie_threshold, size_t k, Admit&& admit) const {
+        // Descending signed value as ascending unsigned bits. The whole 64-bit
+        // bucket is the primary key, as in Views::Before, so no threshold folds
+        // distinct buckets together.
+        auto bucket = [&](const ModelEntity& m) {
+            return ~(static_cast<uint64_t>(Views::TieBucket(RankValue(m.ranks, field), tie_threshold)) ^ 0x8000000000000000ull);
+        };
+        auto recency = [](const ModelEntity& m) { return ~(static_cast<uint32_t>(m.metrics.recency_bonus) ^ 0x80000000u); };
+        return Select(k, admit, bucket, recency);
+    }
+
+    std::vector<size_t> Top(ViewId view, double tie_threshold, size_t k = 0) const {
+        const ViewSpec& spec = Views::Get(view);
+        return Top(spec.field, tie_threshold, k, spec.admits);
+    }
+
+    // Top `k` admitted models by ascending `value(m)`, then name
+    template <typename Admit, typename ValueFn>
+    std::vector<size_t> Lowest(size_t k, Admit&& admit, ValueFn&& value) const {
+        return Select(k, admit, [&](const ModelEntity& m) { return OrderedBits(value(m)); }, [](const ModelEntity&) { return 0u; });
+    }
+};
+
+// Per-view orderings over registry indices, maintained incrementally
+class ViewOrderings {
+    std::array<std::vector<size_t>, VIEW_COUNT> order;
+    double tie_threshold = Config::Weights::TIE_THRESHOLD;
+
+public:
+    // Renumbering entry of a model dropped from the registry
+    static constexpr size_t REMOVED = SIZE_MAX;
+
+    const std::vector<size_t>& Order(ViewId v) const { return order[static_cast<size_t>(v)]; }
+
+    double TieThreshold() const { return tie_threshold; }
+    // Takes effect on the next Rebuild/Update of each view
+    void SetTieThreshold(double t) { tie_threshold = t; }
+
+    void Rebuild(const std::vector<ModelEntity>& registry) {
+        RankingIndex index(registry);
+        for (size_t v = 0; v < VIEW_COUNT; ++v) order[v] = index.Top(static_cast<ViewId>(v), tie_threshold);
+    }
+
+    // Reposition `moved` models in the views of `views`. Small change-sets are
+    // spliced in with binary search; large ones fall back to a full sort.
+    void Update(const std::vector<ModelEntity>& registry, const std::vector<std::pair<size_t, ViewMask>>& moved) {
+        std::vector<char> isMoved(registry.size());
+        std::vector<size_t> batch;
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            batch.clear();
+            for (const auto& [idx, views] : moved) if (views & (1u << v)) batch.push_back(idx);
+            if (batch.empty()) continue;
+
+            auto& ord = order[v];
+            if (batch.size() * 8 > ord.size()) { ord = RankingIndex(registry).Top(static_cast<ViewId>(v), tie_threshold); continue; }
+
+            const ViewSpec& spec = Views::ALL[v];
+            auto before = [&](size_t a, size_t b) { return Views::Before(registry[a], registry[b], spec.field, tie_threshold); };
+            for (size_t idx : batch) isMoved[idx] = 1;
+            ord.erase(std::remove_if(ord.begin(), ord.end(), [&](size_t idx) { return isMoved[idx] != 0; }), ord.end());
+            for (size_t idx : batch) {
+                isMoved[idx] = 0;
+                if (!spec.admits(registry[idx])) continue;
+                ord.insert(std::upper_bound(ord.begin(), ord.end(), idx, before), idx);
+            }
+        }
+    }
+
+    // Drop models whose `remap` entry is REMOVED and renumber the rest. The
+    // survivors keep their relative order, so every view stays sorted.
+    // Returns the views that lost a model.
+    ViewMask Remove(const std::vector<size_t>& remap) {
+        ViewMask lost = 0;
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            auto& ord = order[v];
+            size_t before = ord.size();
+            ord.erase(std::remove_if(ord.begin(), ord.end(), [&](size_t idx) { return remap[idx] == REMOVED; }), ord.end());
+            for (size_t& idx : ord) idx = remap[idx];
+            if (ord.size() != before) lost |= 1u << v;
+        }
+        return lost;
+    }
+};
+
+// --- Incremental Ranking ---
+// A change-set records which inputs moved for which models (and which weights
+// moved globally); IncrementalRanker turns that into the minimal set of field
+// recomputations and view repositions using RankGraph.
+class RankChangeSet {
+    std::map<size_t, InputMask> models;
+    std::set<WeightId> weights;
+    size_t removed = 0;
+    ViewMask removedFrom = 0;
+
+public:
+    void MarkInput(size_t model, RankInput in) { models[model] |= InputBit(in); }
+    void MarkAdded(size_t model) { models[model] = ~InputMask(0); }
+    void MarkWeight(WeightId w) { weights.insert(w); }
+    // Models were dropped from the registry (see ViewOrderings::Remove): renumber
+    // the recorded ones and mark the views that lost a model as reordered
+    void MarkRemoved(const std::vector<size_t>& remap, ViewMask views) {
+        std::map<size_t, InputMask> renumbered;
+        for (const auto& [idx, inputs] : models) if (remap[idx] != ViewOrderings::REMOVED) renumbered[remap[idx]] = inputs;
+        models.swap(renumbered);
+        removed += std::count(remap.begin(), remap.end(), ViewOrderings::REMOVED);
+        removedFrom |= views;
+    }
+
+    bool Empty() const { return models.empty() && weights.empty() && removed == 0; }
+    const std::map<size_t, InputMask>& Models() const { return models; }
+    const std::set<WeightId>& Weights() const { return weights; }
+    size_t Removed() const { return removed; }
+    ViewMask RemovedFrom() const { return removedFrom; }
+};
+
+class IncrementalRanker {
+public:
+    struct Stats {
+        size_t models_touched = 0;
+        size_t models_removed = 0;
+        size_t fields_recomputed = 0;
+        ViewMask views_reordered = 0;
+    };
+
+    // Copy the ranking inputs of a freshly ingested entity into `current`,
+    // recording every input that actually changed.
+    static void Absorb(ModelEntity& current, ModelEntity&& fresh, size_t idx, RankChangeSet& changes) {
+        const auto& a = current.metrics;
+        const auto& b = fresh.metrics;
+        if (current.final_score != fresh.final_score) changes.MarkInput(idx, RankInput::FinalScore);
+        if (a.reasoning_score != b.reasoning_score) changes.MarkInput(idx, RankInput::Reasoning);
+        if (a.coding_score != b.coding_score) changes.MarkInput(idx, RankInput::Coding);
+        if (a.creative_score != b.creative_score) changes.MarkInput(idx, RankInput::Creative);
+        if (a.context_window != b.context_window) changes.MarkInput(idx, RankInput::ContextWindow);
+        if (a.price_input_1m != b.price_input_1m) changes.MarkInput(idx, RankInput::Price);
+        if (a.tokens_per_sec != b.tokens_per_sec) changes.MarkInput(idx, RankInput::Speed);
+        if (a.uptime_sla != b.uptime_sla) changes.MarkInput(idx, RankInput::UptimeSla);
+        if (a.org_maturity != b.org_maturity) changes.MarkInput(idx, RankInput::OrgMaturity);
+        if (a.last_updated_days_ago != b.last_updated_days_ago) changes.MarkInput(idx, RankInput::Recency);
+        if (a.is_enterprise_ready != b.is_enterprise_ready) changes.MarkInput(idx, RankInput::EnterpriseFlag);
+        if (a.is_open_source != b.is_open_source) changes.MarkInput(idx, RankInput::OpenSourceFlag);
+        if (current.modalities != fresh.modalities) changes.MarkInput(idx, RankInput::Modalities);
+        bool signalsChanged = current.signals.size() != fresh.signals.size();
+        for (size_t i = 0; !signalsChanged && i < current.signals.size(); ++i) {
+            const auto& x = current.signals[i];
+            const auto& y = fresh.signals[i];
+            signalsChanged = x.source != y.source || x.score != y.score || x.weight != y.weight;
+        }
+        if (signalsChanged) changes.MarkInput(idx, RankInput::Signals);
+
+        current.organization = std::move(fresh.organization);
+        current.modalities = std::move(fresh.modalities);
+        current.metrics = fresh.metrics;
+        current.signals = std::move(fresh.signals);
+        current.final_score = fresh.final_score;
+    }
+
+    // Recompute exactly the fields reachable from the change-set and splice the
+    // affected models back into their views.
+    template <typename Profile>
+    static Stats Apply(std::vector<ModelEntity>& registry, const RankChangeSet& changes, ViewOrderings& views, const Profile& w) {
+        Stats stats;
+        stats.models_removed = changes.Removed();
+        stats.views_reordered = changes.RemovedFrom();
+        RankMask weightFields = 0;
+        bool confidenceWeights = false;
+        bool tieWeight = false;
+        for (WeightId w : changes.Weights()) {
+            weightFields |= RankGraph::FieldsOf(w);
+            confidenceWeights |= RankGraph::FeedsConfidence(w);
+            tieWeight |= (w == WeightId::TieThreshold);
+        }
+
+        views.SetTieThreshold(w.tie_threshold);
+        std::vector<std::pair<size_t, ViewMask>> moved;
+        auto touch = [&](size_t idx, InputMask inputs) {
+            ModelEntity& m = registry[idx];
+            if ((inputs & RankGraph::CONFIDENCE_DEPS) || confidenceWeights) {
+                double before = m.confidence_score;
+                m.UpdateConfidence(w);
+                if (m.confidence_score != before) inputs |= InputBit(RankInput::Confidence);
+            }
+            RankMask fields = RankGraph::FieldsOf(inputs) | weightFields;
+            if (fields) m.ComputeRanks(fields, w);
+            ViewMask affected = tieWeight ? ALL_VIEWS : Views::Affected(fields, inputs);
+            if (affected) moved.emplace_back(idx, affected);
+            stats.models_touched++;
+            for (size_t f = 0; f < RANK_FIELD_COUNT; ++f) if (fields & (1u << f)) stats.fields_recomputed++;
+            stats.views_reordered |= affected;
+        };
+
+        if (weightFields || confidenceWeights || tieWeight) {
+            // Global change: every model is dirty, but still only in the fields the weights reach
+            auto it = changes.Models().begin();
+            for (size_t i = 0; i < registry.size(); ++i) {
+                InputMask inputs = 0;
+                if (it != changes.Models().end() && it->first == i) inputs = (it++)->second;
+                touch(i, inputs);
+            }
+        } else {
+            for (const auto& [idx, inputs] : changes.Models()) touch(idx, inputs);
+        }
+
+        views.Update(registry, moved);
+        return stats;
+    }
+};
+
+// --- Weight Sensitivity ---
+// Sweeps the five Overall weights over a Sobol sequence and re-ranks the
+// Overall view for every sample. The view is reduced once to five contiguous
+// component columns, so each sample is a dot product plus an integer-key sort
+// with no per-sample allocation; samples are split across threads.
+namespace Sweep {
+    constexpr size_t DIMS = 5;
+    constexpr size_t BINS = 10;
+    constexpr size_t TOP_K = 10;
+    const std::array<const char*, DIMS> WEIGHT_KEYS = {"overall_core", "overall_coding", "overall_creative", "overall_confidence", "overall_price"};
+
+    // 5-dimensional Sobol sequence (Joe-Kuo direction numbers). Points are
+    // computed directly from their index via the Gray code, so any thread can
+    // start anywhere in the sequence.
+    class Sobol {
+        std::array<std::array<uint32_t, 32>, DIMS> v{};
+    public:
+        Sobol() {
+            struct Poly { unsigned s, a; uint32_t m[3]; };
+            static const Poly POLYS[DIMS - 1] = {{1, 0, {1}}, {2, 1, {1, 3}}, {3, 1, {1, 3, 1}}, {3, 2, {1, 1, 1}}};
+            for (unsigned k = 0; k < 32; ++k) v[0][k] = 1u << (31 - k);
+            for (size_t d = 1; d < DIMS; ++d) {
+                const Poly& p = POLYS[d - 1];
+                for (unsigned k = 0; k < 32; ++k) {
+                    if (k < p.s) { v[d][k] = p.m[k] << (31 - k); continue; }
+                    v[d][k] = v[d][k - p.s] ^ (v[d][k - p.s] >> p.s);
+                    for (unsigned j = 1; j < p.s; ++j) {
+                        if ((p.a >> (p.s - 1 - j)) & 1u) v[d][k] ^= v[d][k - j];
+                    }
+                }
+            }
+        }
+
+        void Point(uint32_t index, double out[DIMS]) const {
+            uint32_t gray = index ^ (index >> 1);
+            for (size_t d = 0; d < DIMS; ++d) {
+                uint32_t x = 0;
+                for (unsigned k = 0; gray >> k; ++k) if ((gray >> k) & 1u) x ^= v[d][k];
+                out[d] = x * (1.0 / 4294967296.0);
+            }
+        }
+    };
+
+    struct Options {
+        size_t samples = 100000;
+        double span = 0.5;     // Each weight varies within base * [1 - span, 1 + span]
+        unsigned threads = 0;  // 0: hardware concurrency
+    };
+
+    struct ModelRange {
+        size_t index = 0;      // Registry index
+        uint32_t base_rank = 0, min_rank = 0, max_rank = 0;
+        double mean_rank = 0.0;
+        double top10_rate = 0.0;
+    };
+
+    // Where in weight space a model's top-10 membership differs from the baseline
+    struct Flip {
+        size_t index = 0;
+        bool enters = false;   // Outside the baseline top-10 but enters it under some weights
+        uint64_t count = 0;
+        std::array<double, DIMS> lo{}, hi{};                    // Bounding box of flipping samples
+        std::array<std::array<uint64_t, BINS>, DIMS> bins{};    // Flips per weight bin
+    };
+
+    struct Report {
+        Options options;
+        std::array<double, DIMS> base{};
+        std::array<std::array<uint64_t, BINS>, DIMS> samples_per_bin{};
+        std::vector<ModelRange> models;   // In baseline rank order
+        std::vector<Flip> flips;          // Most frequent first
+        double elapsed_ms = 0.0;
+
+        // Fraction of samples in the bin that flipped this model
+        double BinRate(const Flip& f, size_t d, size_t b) const {
+            return samples_per_bin[d][b] ? static_cast<double>(f.bins[d][b]) / samples_per_bin[d][b] : 0.0;
+        }
+    };
+
+    class Engine {
+        size_t n = 0;
+        std::vector<size_t> members;                 // Registry index per column row
+        std::array<std::vector<double>, DIMS> cols;  // final, coding, creative, conf factor, price factor
+        std::vector<uint32_t> tie;                   // Tie-break rank: recency, then name
+        std::vector<uint32_t> rowOfTie;              // Inverse of `tie`
+        std::array<double, DIMS> base{};
+        double tieThreshold = 0.0;
+
+        struct Accum {
+            std::vector<uint32_t> minRank, maxRank;
+            std::vector<uint64_t> sumRank, top;
+            std::unordered_map<size_t, Flip> flips;
+            std::array<std::array<uint64_t, BINS>, DIMS> perBin{};
+        };
+
+    public:
+        template <typename Profile>
+        Engine(const std::vector<ModelEntity>& registry, const std::vector<size_t>& overallView, const Profile& w)
+            : n(overallView.size()), members(overallView) {
+            base = {w.overall_core, w.overall_coding, w.overall_creative, w.overall_confidence, w.overall_price};
+            tieThreshold = w.tie_threshold;
+            for (auto& c : cols) c.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                const ModelEntity& m = registry[members[i]];
+                cols[0][i] = m.final_score;
+                cols[1][i] = m.metrics.coding_score;
+                cols[2][i] = m.metrics.creative_score;
+                cols[3][i] = m.confidence_score / 100.0;
+                cols[4][i] = 1.0 / (1.0 + m.metrics.price_input_1m / 10.0);
+            }
+            tie = Views::TieRanks(registry, members);
+            rowOfTie.resize(n);
+            for (uint32_t i = 0; i < n; ++i) rowOfTie[tie[i]] = i;
+        }
+
+        Report Run(const Options& opt) const {
+            Report report;
+            report.options = opt;
+            report.base = base;
+            if (n == 0 || opt.samples == 0) return report;
+            auto start = std::chrono::steady_clock::now();
+
+            // Baseline ordering through the same kernel
+            std::vector<uint64_t> keys(n);
+            std::vector<int64_t> buckets(n);
+            std::vector<uint32_t> baseRank(n);
+            std::vector<char> baseTop(n);
+            RankSample(base.data(), keys, buckets);
+            for (uint32_t r = 0; r < n; ++r) {
+                uint32_t i = static_cast<uint32_t>(keys[r]);
+                baseRank[i] = r + 1;
+                baseTop[i] = r < TOP_K;
+            }
+
+            unsigned threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+            threads = static_cast<unsigned>(std::min<size_t>(threads, opt.samples));
+            std::vector<Accum> acc(threads);
+            std::vector<std::thread> pool;
+            Sobol sobol;
+            for (unsigned t = 0; t < threads; ++t) {
+                size_t begin = opt.samples * t / threads;
+                size_t end = opt.samples * (t + 1) / threads;
+                pool.emplace_back([&, t, begin, end] { Worker(sobol, opt, begin, end, baseTop, acc[t]); });
+            }
+            for (auto& th : pool) th.join();
+
+            // Merge per-thread accumulators
+            Accum& total = acc[0];
+            for (unsigned t = 1; t < threads; ++t) {
+                for (size_t i = 0; i < n; ++i) {
+                    total.minRank[i] = std::min(total.minRank[i], acc[t].minRank[i]);
+                    total.maxRank[i] = std::max(total.maxRank[i], acc[t].maxRank[i]);
+                    total.sumRank[i] += acc[t].sumRank[i];
+                    total.top[i] += acc[t].top[i];
+                }
+                for (size_t d = 0; d < DIMS; ++d) for (size_t b = 0; b < BINS; ++b) total.perBin[d][b] += acc[t].perBin[d][b];
+                for (auto& [i, f] : acc[t].flips) {
+                    auto [it, inserted] = total.flips.emplace(i, f);
+                    if (inserted) continue;
+                    Flip& g = it->second;
+                    g.count += f.count;
+                    for (size_t d = 0; d < DIMS; ++d) {
+                        g.lo[d] = std::min(g.lo[d], f.lo[d]);
+                        g.hi[d] = std::max(g.hi[d], f.hi[d]);
+                        for (size_t b = 0; b < BINS; ++b) g.bins[d][b] += f.bins[d][b];
+                    }
+                }
+            }
+
+            report.samples_per_bin = total.perBin;
+            std::vector<uint32_t> byBase(n);
+            for (uint32_t i = 0; i < n; ++i) byBase[baseRank[i] - 1] = i;
+            for (uint32_t i : byBase) {
+                ModelRange r;
+                r.index = members[i];
+                r.base_rank = baseRank[i];
+                r.min_rank = total.minRank[i];
+                r.max_rank = total.maxRank[i];
+                r.mean_rank = static_cast<double>(total.sumRank[i]) / opt.samples;
+                r.top10_rate = static_cast<double>(total.top[i]) / opt.samples;
+                report.models.push_back(r);
+            }
+            for (auto& [i, f] : total.flips) {
+                Flip out = f;
+                out.index = members[i];
+                report.flips.push_back(out);
+            }
+            std::sort(report.flips.begin(), report.flips.end(), [](const Flip& a, const Flip& b) {
+                return a.count != b.count ? a.count > b.count : a.index < b.index;
+            });
+            report.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return report;
+        }
+
+    private:
+        // Score every row for one weight vector and sort by the leaderboard
+        // ordering (tie bucket, then tie rank). On return keys[r] is the row at rank r+1.
+        void RankSample(const double* w, std::vector<uint64_t>& keys, std::vector<int64_t>& buckets) const {
+            const double* c0 = cols[0].data(); const double* c1 = cols[1].data(); const double* c2 = cols[2].data();
+            const double* c3 = cols[3].data(); const double* c4 = cols[4].data();
+            const double w0 = w[0], w1 = w[1], w2 = w[2], w3 = w[3], w4 = w[4];
+            for (size_t i = 0; i < n; ++i) {
+                double score = (c0[i] * w0 + c1[i] * w1 + c2[i] * w2 + c3[i] * w3 + c4[i] * w4) * 100.0;
+                buckets[i] = Views::TieBucket(score, tieThreshold);
+            }
+            const auto [lo, hi] = std::minmax_element(buckets.begin(), buckets.begin() + n);
+            const int64_t top = *hi;
+            if (static_cast<uint64_t>(top - *lo) <= 0xFFFFFFFFull) {
+                // Every bucket's distance below the highest fits 32 bits: pack it with the tie rank
+                for (size_t i = 0; i < n; ++i) keys[i] = static_cast<uint64_t>(top - buckets[i]) << 32 | tie[i];
+                std::sort(keys.begin(), keys.end());
+            } else {
+                // A tiny tie threshold spreads the buckets wider; compare them in full
+                for (size_t i = 0; i < n; ++i) keys[i] = tie[i];
+                std::sort(keys.begin(), keys.end(), [&](uint64_t a, uint64_t b) {
+                    int64_t ba = buckets[rowOfTie[a]], bb = buckets[rowOfTie[b]];
+                    return ba != bb ? ba > bb : a < b;
+                });
+            }
+            // Tie ranks are unique, so they identify the row
+            for (size_t r = 0; r < n; ++r) keys[r] = rowOfTie[static_cast<uint32_t>(keys[r])];
+        }
+
+        void Worker(const Sobol& sobol, const Options& opt, size_t begin, size_t end,
+                    const std::vector<char>& baseTop, Accum& a) const {
+            a.minRank.assign(n, UINT32_MAX);
+            a.maxRank.assign(n, 0);
+            a.sumRank.assign(n, 0);
+            a.top.assign(n, 0);
+            std::vector<uint64_t> keys(n);
+            std::vector<int64_t> buckets(n);
+            std::vector<char> inTop(n);
+            double u[DIMS], w[DIMS];
+            size_t bin[DIMS];
+            double baseSum = 0.0;
+            for (double b : base) baseSum += b;
+            for (size_t s = begin; s < end; ++s) {
+                sobol.Point(static_cast<uint32_t>(s + 1), u); // Index 0 is the all-zero corner
+                double sum = 0.0;
+                for (size_t d = 0; d < DIMS; ++d) {
+                    w[d] = base[d] * (1.0 - opt.span + 2.0 * opt.span * u[d]);
+                    sum += w[d];
+                }
+                // Rescaled to the baseline's total: tie buckets are fixed-width, so
+                // scores must stay on the scale the baseline was ranked on
+                const double scale = sum > 0.0 ? baseSum / sum : 1.0;
+                for (size_t d = 0; d < DIMS; ++d) {
+                    w[d] *= scale;
+                    bin[d] = std::min(BINS - 1, static_cast<size_t>(u[d] * BINS));
+                    a.perBin[d][bin[d]]++;
+                }
+
+                RankSample(w, keys, buckets);
+                for (uint32_t r = 0; r < n; ++r) {
+                    uint32_t i = static_cast<uint32_t>(keys[r]);
+                    a.minRank[i] = std::min(a.minRank[i], r + 1);
+                    a.maxRank[i] = std::max(a.maxRank[i], r + 1);
+                    a.sumRank[i] += r + 1;
+                }
+
+                size_t k = std::min(TOP_K, n);
+                for (size_t r = 0; r < k; ++r) {
+                    uint32_t i = static_cast<uint32_t>(keys[r]);
+                    inTop[i] = 1;
+                    a.top[i]++;
+                    if (!baseTop[i]) RecordFlip(a, i, true, w, bin);
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    if (baseTop[i] && !inTop[i]) RecordFlip(a, i, false, w, bin);
+                }
+                for (size_t r = 0; r < k; ++r) inTop[static_cast<uint32_t>(keys[r])] = 0;
+            }
+        }
+
+        static void RecordFlip(Accum& a, size_t row, bool enters, const double* w, const size_t* bin) {
+            auto [it, inserted] = a.flips.try_emplace(row);
+            Flip& f = it->second;
+            if (inserted) {
+                f.enters = enters;
+                for (size_t d = 0; d < DIMS; ++d) f.lo[d] = f.hi[d] = w[d];
+            }
+            f.count++;
+            for (size_t d = 0; d < DIMS; ++d) {
+                f.lo[d] = std::min(f.lo[d], w[d]);
+                f.hi[d] = std::max(f.hi[d], w[d]);
+                f.bins[d][bin[d]]++;
+            }
+        }
+    };
+
+    json ToJSON(const Report& r, const std::vector<ModelEntity>& registry) {
+        json j;
+        j["samples"] = r.options.samples;
+        j["span"] = r.options.span;
+        j["sequence"] = "sobol";
+        // flip_rate_by_bin splits each weight's multiplier range [1 - span, 1 + span] into equal bins
+        j["bins"] = BINS;
+        json base = json::object();
+        for (size_t d = 0; d < DIMS; ++d) base[WEIGHT_KEYS[d]] = r.base[d];
+        j["base_weights"] = base;
+
+        json models = json::array();
+        for (const auto& m : r.models) {
+            models.push_back({
+                {"name", registry[m.index].name},
+                {"org", registry[m.index].organization},
+                {"base_rank", m.base_rank},
+                {"min_rank", m.min_rank},
+                {"max_rank", m.max_rank},
+                {"mean_rank", m.mean_rank},
+                {"top10_rate", m.top10_rate}
+            });
+        }
+        j["models"] = models;
+
+        json flips = json::array();
+        for (const auto& f : r.flips) {
+            json region = json::object();
+            for (size_t d = 0; d < DIMS; ++d) {
+                json rates = json::array();
+                for (size_t b = 0; b < BINS; ++b) rates.push_back(r.BinRate(f, d, b));
+                region[WEIGHT_KEYS[d]] = {{"min", f.lo[d]}, {"max", f.hi[d]}, {"flip_rate_by_bin", rates}};
+            }
+            flips.push_back({
+                {"name", registry[f.index].name},
+                {"direction", f.enters ? "enters" : "leaves"},
+                {"flip_rate", static_cast<double>(f.count) / r.options.samples},
+                {"region", region}
+            });
+        }
+        j["top10_flips"] = flips;
+        return j;
+    }
+}
+
+// --- Rank Confidence Intervals ---
+// Monte Carlo resampling: every iteration perturbs each model's signals and
+// metrics under a per-source noise model, re-runs the confidence and rank
+// kernels, re-ranks every view and bins the resulting positions. Randomness is
+// counter-based (Philox), keyed by (iteration, model), so threads never share
+// state and results do not depend on the thread count.
+namespace Resample {
+    // Philox4x32-10 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3")
+    inline std::array<uint32_t, 4> Philox(std::array<uint32_t, 4> ctr, std::array<uint32_t, 2> key) {
+        for (int round = 0; round < 10; ++round) {
+            if (round) { key[0] += 0x9E3779B9u; key[1] += 0xBB67AE85u; }
+            uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * ctr[0];
+            uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * ctr[2];
+            ctr = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<uint32_t>(p1),
+                   static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<uint32_t>(p0)};
+        }
+        return ctr;
+    }
+
+    // Standard normals for one (iteration, model) pair; lives on the stack
+    class NormalStream {
+        std::array<uint32_t, 2> key;
+        std::array<uint32_t, 4> ctr;
+        double buf[4] = {};
+        int left = 0;
+    public:
+        NormalStream(uint64_t seed, uint32_t iteration, uint32_t model)
+            : key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}, ctr{iteration, model, 0, 0} {}
+
+        double Next() {
+            if (left == 0) {
+                std::array<uint32_t, 4> r = Philox(ctr, key);
+                ctr[2]++;
+                for (int i = 0; i < 4; i += 2) {
+                    double u1 = (r[i] + 1.0) * (1.0 / 4294967296.0); // (0, 1]
+                    double u2 = r[i + 1] * (1.0 / 4294967296.0);
+                    double rad = std::sqrt(-2.0 * std::log(u1));
+                    buf[i] = rad * std::cos(6.283185307179586 * u2);
+                    buf[i + 1] = rad * std::sin(6.283185307179586 * u2);
+                }
+                left = 4;
+            }
+            return buf[4 - left--];
+        }
+    };
+
+    // Noise per signal source (absolute, on the 0-1 score scale) and per metric
+    struct NoiseModel {
+        std::map<std::string, double> source_sigma = {{"ZeroEval GPQA", 0.02}, {"Avg Score", 0.04}};
+        double default_source_sigma = 0.05;
+        double coding_sigma = 0.03;      // Absolute
+        double creative_sigma = 0.03;    // Absolute
+        double price_rel_sigma = 0.05;   // Relative
+        double speed_rel_sigma = 0.10;   // Relative
+
+        double SourceSigma(const std::string& source) const {
+            auto it = source_sigma.find(source);
+            return it != source_sigma.end() ? it->second : default_source_sigma;
+        }
+    };
+
+    struct Options {
+        size_t iterations = 10000;
+        uint64_t seed = 0x5EED5EEDull;
+        unsigned threads = 0;  // 0: hardware concurrency
+        NoiseModel noise;
+    };
+
+    struct Interval {
+        size_t index = 0;      // Registry index
+        uint32_t base_rank = 0;
+        uint32_t lo = 0, median = 0, hi = 0; // 2.5th / 50th / 97.5th percentile rank
+        double mean = 0.0;
+    };
+
+    struct Report {
+        Options options;
+        std::array<std::vector<Interval>, VIEW_COUNT> views; // In baseline order
+        double elapsed_ms = 0.0;
+    };
+
+    // Each member of each view keeps a fixed-size rank histogram, so scratch
+    // memory grows linearly with the catalog. A short pilot run places its
+    // window: the pilot's rank range, widened by half of it on both sides, split
+    // into BINS fine bins (exact ranks when it is at most BINS wide). TAIL coarse
+    // bins on each side cover the rest of [1, count], so a tail the pilot missed
+    // still gets a bounded answer. The pilot and the bins are deterministic, so
+    // the merged histograms do not depend on the thread count.
+    class Engine {
+        static constexpr size_t BINS = 64;              // Fine rank bins per member and view
+        static constexpr size_t TAIL = 16;              // Coarse bins below and above the window
+        static constexpr size_t SLOTS = BINS + 2 * TAIL;
+        static constexpr size_t PILOT = 128;            // Iterations that place the windows
+
+        size_t n = 0;
+        // Flattened, read-only model state
+        std::vector<RankInputs> base;
+        std::vector<uint32_t> sigBegin;          // Signals of model i: [sigBegin[i], sigBegin[i + 1])
+        std::vector<double> sigScore, sigWeight, sigSigma;
+        std::vector<int> daysAgo;
+        std::vector<char> multimodal, enterprise;
+        std::vector<uint32_t> tie;               // Tie-break rank: recency, then name
+        std::vector<uint32_t> modelOfTie;        // Inverse of `tie`
+        std::array<std::vector<uint32_t>, VIEW_COUNT> members; // Baseline view order
+
+        // Histogram layout of one member: TAIL bins over [1, first), BINS bins
+        // over [first, end), TAIL bins over [end, count]
+        struct Window {
+            uint32_t first = 1, end = 1;
+            uint32_t below = 1, width = 1, above = 1; // Bin widths
+
+            Window() = default;
+            Window(uint32_t lo, uint32_t hi, size_t count) {
+                uint32_t span = (hi - lo) / 2 + 1;
+                first = lo > span ? lo - span : 1;
+                uint32_t last = static_cast<uint32_t>(std::min<size_t>(count, size_t{hi} + span));
+                width = static_cast<uint32_t>((last - first + BINS) / BINS);
+                end = static_cast<uint32_t>(std::min<size_t>(count + 1, first + BINS * width));
+                below = static_cast<uint32_t>(std::max<size_t>(1, (first - 1 + TAIL - 1) / TAIL));
+                above = static_cast<uint32_t>(std::max<size_t>(1, (count + 1 - end + TAIL - 1) / TAIL));
+            }
+
+            size_t Slot(uint32_t rank) const {
+                if (rank < first) return (rank - 1) / below;
+                if (rank < end) return TAIL + (rank - first) / width;
+                return TAIL + BINS + (rank - end) / above;
+            }
+
+            // Highest rank a slot holds
+            size_t Upper(size_t slot, size_t count) const {
+                if (slot < TAIL) return std::min<size_t>(first - 1, (slot + 1) * below);
+                if (slot < TAIL + BINS) return std::min<size_t>(end - 1, first + (slot - TAIL + 1) * width - 1);
+                return std::min<size_t>(count, end + (slot - TAIL - BINS + 1) * above - 1);
+            }
+        };
+        using Windows = std::array<std::vector<Window>, VIEW_COUNT>;
+
+        struct Scratch {
+            std::vector<RankScores> scores;
+            std::vector<double> sig;
+            std::vector<std::pair<int64_t, uint32_t>> keys;
+            std::vector<uint32_t> slot; // Registry index -> position in the current view's member list
+            std::array<std::vector<uint32_t>, VIEW_COUNT> hist;    // [member * SLOTS + slot]; pilot: [member * 2] = min, max rank
+            std::array<std::vector<uint64_t>, VIEW_COUNT> rankSum;
+        };
+
+    public:
+        Engine(const std::vector<ModelEntity>& registry, const ViewOrderings& orderings, const NoiseModel& noise)
+            : n(registry.size()) {
+            base.reserve(n);
+            sigBegin.reserve(n + 1);
+            for (const auto& m : registry) {
+                base.push_back(m.Inputs());
+                sigBegin.push_back(static_cast<uint32_t>(sigScore.size()));
+                for (const auto& s : m.signals) {
+                    sigScore.push_back(s.score);
+                    sigWeight.push_back(s.weight);
+                    sigSigma.push_back(noise.SourceSigma(s.source));
+                }
+                daysAgo.push_back(m.metrics.last_updated_days_ago);
+                multimodal.push_back(m.modalities.size() > 1);
+                enterprise.push_back(m.metrics.is_enterprise_ready);
+            }
+            sigBegin.push_back(static_cast<uint32_t>(sigScore.size()));
+
+            std::vector<size_t> all(n);
+            std::iota(all.begin(), all.end(), size_t{0});
+            tie = Views::TieRanks(registry, all);
+            modelOfTie.resize(n);
+            for (uint32_t i = 0; i < n; ++i) modelOfTie[tie[i]] = i;
+
+            for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                const auto& ord = orderings.Order(static_cast<ViewId>(v));
+                members[v].assign(ord.begin(), ord.end());
+            }
+        }
+
+        // Histogram and rank-sum bytes each worker thread holds
+        size_t ScratchBytes() const {
+            size_t count = 0;
+            for (const auto& m : members) count += m.size();
+            return count * (SLOTS * sizeof(uint32_t) + sizeof(uint64_t));
+        }
+
+        template <typename Profile>
+        Report Run(const Options& opt, const Profile& w) const {
+            Report report;
+            report.options = opt;
+            if (n == 0 || opt.iterations == 0) return report;
+            auto start = std::chrono::steady_clock::now();
+
+            unsigned threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+            std::vector<Scratch> scratch(threads);
+
+            // Pilot: each member's rank range over the first iterations
+            const size_t pilot = std::min(opt.iterations, PILOT);
+            Parallel(pilot, scratch, [&](size_t begin, size_t end, Scratch& s) {
+                for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                    s.hist[v].resize(members[v].size() * 2);
+                    for (size_t j = 0; j < members[v].size(); ++j) {
+                        s.hist[v][j * 2] = UINT32_MAX;
+                        s.hist[v][j * 2 + 1] = 0;
+                    }
+                }
+                for (size_t it = begin; it < end; ++it) {
+                    Iterate(opt, w, it, s, [&](size_t v, size_t j, uint32_t rank) {
+                        uint32_t* range = &s.hist[v][j * 2];
+                        range[0] = std::min(range[0], rank);
+                        range[1] = std::max(range[1], rank);
+                    });
+                }
+            });
+            Windows windows;
+            for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                const size_t count = members[v].size();
+                windows[v].resize(count);
+                for (size_t j = 0; j < count; ++j) {
+                    uint32_t lo = UINT32_MAX, hi = 0;
+                    for (const Scratch& s : scratch) {
+                        if (s.hist[v].size() != count * 2) continue; // Thread ran no pilot iterations
+                        lo = std::min(lo, s.hist[v][j * 2]);
+                        hi = std::max(hi, s.hist[v][j * 2 + 1]);
+                    }
+                    windows[v][j] = Window(lo, hi, count);
+                }
+            }
+
+            Parallel(opt.iterations, scratch, [&](size_t begin, size_t end, Scratch& s) {
+                for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                    s.hist[v].assign(members[v].size() * SLOTS, 0);
+                    s.rankSum[v].assign(members[v].size(), 0);
+                }
+                for (size_t it = begin; it < end; ++it) {
+                    Iterate(opt, w, it, s, [&](size_t v, size_t j, uint32_t rank) {
+                        s.hist[v][j * SLOTS + windows[v][j].Slot(rank)]++;
+                        s.rankSum[v][j] += rank;
+                    });
+                }
+            });
+
+            for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                const size_t count = members[v].size();
+                std::vector<uint32_t> hist(count * SLOTS);
+                std::vector<uint64_t> rankSum(count);
+                for (const Scratch& s : scratch) {
+                    if (s.hist[v].size() != hist.size()) continue; // Thread ran no iterations
+                    for (size_t k = 0; k < hist.size(); ++k) hist[k] += s.hist[v][k];
+                    for (size_t j = 0; j < count; ++j) rankSum[j] += s.rankSum[v][j];
+                }
+                for (size_t j = 0; j < count; ++j) {
+                    Interval iv;
+                    iv.index = members[v][j];
+                    iv.base_rank = static_cast<uint32_t>(j + 1);
+                    iv.mean = static_cast<double>(rankSum[j]) / opt.iterations;
+                    const uint32_t* h = &hist[j * SLOTS];
+                    iv.lo = Percentile(h, windows[v][j], count, opt.iterations, 0.025);
+                    iv.median = Percentile(h, windows[v][j], count, opt.iterations, 0.5);
+                    iv.hi = Percentile(h, windows[v][j], count, opt.iterations, 0.975);
+                    report.views[v].push_back(iv);
+                }
+            }
+            report.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return report;
+        }
+
+    private:
+        // Splits iterations [0, total) across one thread per scratch slot
+        template <typename Body>
+        static void Parallel(size_t total, std::vector<Scratch>& scratch, Body&& body) {
+            const size_t threads = scratch.size();
+            std::vector<std::thread> pool;
+            for (size_t t = 0; t < threads; ++t) {
+                size_t begin = total * t / threads;
+                size_t end = total * (t + 1) / threads;
+                if (begin == end) continue;
+                pool.emplace_back([&, t, begin, end] { body(begin, end, scratch[t]); });
+            }
+            for (auto& th : pool) th.join();
+        }
+
+        // Rank (1-based, upper edge of the bin) at quantile q of a member's histogram
+        static uint32_t Percentile(const uint32_t* h, const Window& win, size_t count, size_t total, double q) {
+            uint64_t target = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(q * total)), 1);
+            uint64_t seen = 0;
+            for (size_t k = 0; k < SLOTS; ++k) {
+                seen += h[k];
+                if (seen >= target) return static_cast<uint32_t>(win.Upper(k, count));
+            }
+            return static_cast<uint32_t>(count);
+        }
+
+        // One resampling iteration: perturbs every model, re-ranks every view and
+        // calls record(view, member, rank) for each member. Buffers are sized on
+        // first use; later iterations do not allocate.
+        template <typename Profile, typename Record>
+        void Iterate(const Options& opt, const Profile& w, size_t it, Scratch& s, Record&& record) const {
+            if (s.scores.size() != n) {
+                s.scores.resize(n);
+                s.sig.resize(sigScore.size());
+                size_t widest = 0;
+                for (const auto& m : members) widest = std::max(widest, m.size());
+                s.keys.resize(widest);
+                s.slot.resize(n);
+            }
+
+            const NoiseModel& noise = opt.noise;
+            for (size_t i = 0; i < n; ++i) {
+                NormalStream z(opt.seed, static_cast<uint32_t>(it), static_cast<uint32_t>(i));
+                RankInputs in = base[i];
+
+                double weighted = 0.0, total = 0.0;
+                const uint32_t sb = sigBegin[i], se = sigBegin[i + 1];
+                for (uint32_t k = sb; k < se; ++k) {
+                    s.sig[k] = std::clamp(sigScore[k] + sigSigma[k] * z.Next(), 0.0, 1.0);
+                    weighted += s.sig[k] * sigWeight[k];
+                    total += sigWeight[k];
+                }
+                if (total > 0.0) {
+                    double fs = weighted / total;
+                    in.reasoning_score += fs - in.final_score;
+                    in.final_score = fs;
+                }
+                in.coding_score = std::max(0.0, in.coding_score + noise.coding_sigma * z.Next());
+                in.creative_score = std::clamp(in.creative_score + noise.creative_sigma * z.Next(), 0.0, 1.0);
+                in.price_input_1m = std::max(0.0, in.price_input_1m * (1.0 + noise.price_rel_sigma * z.Next()));
+                in.tokens_per_sec = std::max(0.0, in.tokens_per_sec * (1.0 + noise.speed_rel_sigma * z.Next()));
+
+                bool versatile = ModelEntity::IsVersatile(in.coding_score, in.creative_score, multimodal[i] != 0);
+                in.confidence_score = ModelEntity::ConfidenceKernel(se - sb, [&](size_t k) { return s.sig[sb + k]; },
+                                                                    in.final_score, daysAgo[i], versatile, enterprise[i] != 0, w);
+                ModelEntity::RankKernel(in, ALL_RANK_FIELDS, s.scores[i], w);
+            }
+
+            for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                const auto& mem = members[v];
+                const size_t count = mem.size();
+                const RankField field = Views::ALL[v].field;
+                for (size_t j = 0; j < count; ++j) {
+                    s.slot[mem[j]] = static_cast<uint32_t>(j);
+                    s.keys[j] = {-Views::TieBucket(RankValue(s.scores[mem[j]], field), w.tie_threshold), tie[mem[j]]};
+                }
+                std::sort(s.keys.begin(), s.keys.begin() + count);
+                for (size_t r = 0; r < count; ++r) {
+                    record(v, s.slot[modelOfTie[s.keys[r].second]], static_cast<uint32_t>(r + 1)); // Tie ranks are unique per model
+                }
+            }
+        }
+    };
+
+    json ToJSON(const Report& r, const std::vector<ModelEntity>& registry) {
+        json j;
+        j["iterations"] = r.options.iterations;
+        j["seed"] = r.options.seed;
+        json sources = json::object();
+        for (const auto& [src, sigma] : r.options.noise.source_sigma) sources[src] = sigma;
+        j["noise"] = {
+            {"source_sigma", sources},
+            {"default_source_sigma", r.options.noise.default_source_sigma},
+            {"coding_sigma", r.options.noise.coding_sigma},
+            {"creative_sigma", r.options.noise.creative_sigma},
+            {"price_rel_sigma", r.options.noise.price_rel_sigma},
+            {"speed_rel_sigma", r.options.noise.speed_rel_sigma}
+        };
+        json views = json::object();
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            json rows = json::array();
+            for (const auto& iv : r.views[v]) {
+                rows.push_back({
+                    {"name", registry[iv.index].name},
+                    {"base_rank", iv.base_rank},
+                    {"ci_low", iv.lo},
+                    {"median", iv.median},
+                    {"ci_high", iv.hi},
+                    {"mean", iv.mean}
+                });
+            }
+            views[Views::ALL[v].key] = rows;
+        }
+        j["views"] = views;
+        return j;
+    }
+}
+
+// --- Export System ---
+// Serialized WriteJSON record per registry slot, kept across exports and
+// re-rendered only when the model's OutputHash changes. In watch mode the
+// JSON export then costs in proportion to churn, not catalog size.
+class FragmentCache {
+    struct Fragment {
+        uint64_t key = 0;
+        bool valid = false;
+        std::string text;
+    };
+    std::vector<Fragment> fragments;
+
+public:
+    // Re-renders stale fragments; returns how many were rebuilt
+    size_t Refresh(const std::vector<ModelEntity>& registry) {
+        fragments.resize(registry.size());
+        size_t rebuilt = 0;
+        for (size_t i = 0; i < registry.size(); ++i) {
+            Fragment& f = fragments[i];
+            uint64_t key = registry[i].OutputHash();
+            if (f.valid && f.key == key) continue;
+            f.text.clear();
+            BufferedWriter out(&f.text);
+            registry[i].WriteJSON(out);
+            f.key = key;
+            f.valid = true;
+            rebuilt++;
+        }
+        return rebuilt;
+    }
+
+    std::string_view Text(size_t i) const { return fragments[i].text; }
+
+    // Follow the registry when models are dropped (see ViewOrderings::Remove)
+    void Renumber(const std::vector<size_t>& remap) {
+        size_t kept = 0;
+        for (size_t i = 0; i < std::min(remap.size(), fragments.size()); ++i) {
+            if (remap[i] == ViewOrderings::REMOVED) continue;
+            if (remap[i] != i) fragments[remap[i]] = std::move(fragments[i]);
+            kept = remap[i] + 1;
+        }
+        fragments.resize(kept);
+    }
+};
+
+// Immutable result of one ranking pass. Every writer reads the same snapshot,
+// so orderings and the JSON payload are derived exactly once per export.
+struct ExportSnapshot {
+    static constexpr size_t CSV_ROWS = 100;
+    static constexpr size_t TEXT_ROWS = 50;
+
+    const std::vector<ModelEntity>& registry;
+    double tie_threshold;
+    std::vector<size_t> overall;  // All models by Overall, top CSV_ROWS
+    std::vector<size_t> value;    // Value view with a positive value, top CSV_ROWS
+    std::vector<size_t> cheapest; // Known prices, cheapest first, top CSV_ROWS
+    std::vector<std::pair<std::string_view, double>> ecosystem; // Organization share scores, by name
+    const FragmentCache* fragments = nullptr; // Pre-rendered model records, when available
+    size_t fragments_rebuilt = 0;
+
+    // Dashboard rows per view: every model in the top SHARD_ROWS of the
+    // leaderboard order or of an alternate sort, plus each sort's order as
+    // positions into `rows`, so the page never sorts
+    static constexpr size_t SHARD_ROWS = Config::DASHBOARD_ROWS;
+    enum class Sort : uint8_t { Default, PriceAsc, SpeedDesc, ConfDesc, Count };
+    static constexpr size_t SORT_COUNT = static_cast<size_t>(Sort::Count);
+    static constexpr const char* SORT_KEYS[SORT_COUNT] = {"default", "price_asc", "speed_desc", "conf_desc"}; // <option> values
+    struct ViewShard {
+        std::vector<size_t> rows;
+        std::array<std::vector<uint32_t>, SORT_COUNT> order;
+    };
+    std::array<ViewShard, VIEW_COUNT> shards;
+    std::vector<size_t> org_models; // Registry models per ecosystem entry
+    std::vector<size_t> org_order;  // Ecosystem entries by score, best first
+
+    // With a cache, stale model records are re-rendered here, before any writer starts
+    static ExportSnapshot Build(const std::vector<ModelEntity>& registry, const ViewOrderings& views,
+                                const std::map<std::string, OrgStats>& orgStats, FragmentCache* cache = nullptr) {
+        ExportSnapshot snap{registry, views.TieThreshold(), {}, {}, {}, {}, cache, 0, {}, {}, {}};
+        if (cache) snap.fragments_rebuilt = cache->Refresh(registry);
+        RankingIndex ranking(registry);
+        snap.overall = ranking.Top(RankField::Overall, snap.tie_threshold, CSV_ROWS, [](const ModelEntity&) { return true; });
+        snap.cheapest = ranking.Lowest(CSV_ROWS,
+            [](const ModelEntity& m) { return m.metrics.price_input_1m < 999999.0; },
+            [](const ModelEntity& m) { return m.metrics.price_input_1m; });
+        // The Value view already holds the full order; only the filter is applied here
+        for (size_t idx : views.Order(ViewId::Value)) {
+            if (snap.value.size() == CSV_ROWS) break;
+            if (registry[idx].ranks.value > 0.0) snap.value.push_back(idx);
+        }
+
+        // Shard position + 1 of each registry model in the shard being built
+        std::vector<uint32_t> position(registry.size());
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            const ViewSpec& spec = Views::ALL[v];
+            const std::vector<size_t>& leaderboard = views.Order(static_cast<ViewId>(v));
+            // Alternate sorts: ascending key, then name, as in Lowest()
+            const std::array<std::vector<size_t>, SORT_COUNT> sorted = {{
+                std::vector<size_t>(leaderboard.begin(), leaderboard.begin() + std::min(leaderboard.size(), SHARD_ROWS)),
+                ranking.Lowest(SHARD_ROWS, spec.admits, [](const ModelEntity& m) { return m.metrics.price_input_1m; }),
+                ranking.Lowest(SHARD_ROWS, spec.admits, [](const ModelEntity& m) { return -m.metrics.tokens_per_sec; }),
+                ranking.Lowest(SHARD_ROWS, spec.admits, [](const ModelEntity& m) { return -m.confidence_score; })
+            }};
+            ViewShard& shard = snap.shards[v];
+            for (size_t k = 0; k < SORT_COUNT; ++k) {
+                shard.order[k].reserve(sorted[k].size());
+                for (size_t idx : sorted[k]) {
+                    if (!position[idx]) {
+                        shard.rows.push_back(idx);
+                        position[idx] = static_cast<uint32_t>(shard.rows.size());
+                    }
+                    shard.order[k].push_back(position[idx] - 1);
+                }
+            }
+            for (size_t idx : shard.rows) position[idx] = 0;
+        }
+
+        std::unordered_map<std::string_view, size_t> perOrg;
+        for (const auto& m : registry) perOrg[m.organization]++;
+        snap.ecosystem.reserve(orgStats.size());
+        snap.org_models.reserve(orgStats.size());
+        for (const auto& [org, s] : orgStats) {
+             double avg = (s.model_count > 0) ? (s.avg_score / s.model_count) : 0.0;
+             double score = (s.model_count * 0.4) + (avg * 10.0 * 0.3);
+             snap.ecosystem.emplace_back(org, score);
+             auto it = perOrg.find(org);
+             snap.org_models.push_back(it == perOrg.end() ? 0 : it->second);
+        }
+        snap.org_order.resize(snap.ecosystem.size());
+        std::iota(snap.org_order.begin(), snap.org_order.end(), size_t(0));
+        std::stable_sort(snap.org_order.begin(), snap.org_order.end(),
+                         [&](size_t a, size_t b) { return snap.ecosystem[a].second > snap.ecosystem[b].second; });
+        return snap;
+    }
+
+    void WriteEcosystem(BufferedWriter& out) const {
+        out.Put("{");
+        for (size_t i = 0; i < ecosystem.size(); ++i) {
+            if (i) out.Put(',');
+            out.JsonString(ecosystem[i].first).Put(':').JsonNumber(ecosystem[i].second);
+        }
+        out.Put("}");
+    }
+
+    void WriteModel(BufferedWriter& out, size_t i) const {
+        if (fragments) out.Put(fragments->Text(i));
+        else registry[i].WriteJSON(out);
+    }
+
+    // Streams {"ecosystem": {...}, "models": [...]} without building it in memory
+    void WritePayload(BufferedWriter& out) const {
+        out.Put("{\"ecosystem\":");
+        WriteEcosystem(out);
+        out.Put(",\"models\":[");
+        for (size_t i = 0; i < registry.size(); ++i) {
+            if (i) out.Put(',');
+            WriteModel(out, i);
+        }
+        out.Put("]}");
+    }
+
+    // Newline-delimited form of the payload: one model record per line, in
+    // registry order, then a final {"ecosystem": {...}} line. Consumers can
+    // process it a line at a time.
+    void WriteNdjson(BufferedWriter& out) const {
+        for (size_t i = 0; i < registry.size(); ++i) {
+            WriteModel(out, i);
+            out.Put('\n');
+        }
+        out.Put("{\"ecosystem\":");
+        WriteEcosystem(out);
+        out.Put("}\n");
+    }
+};
+
+class DataExporter {
+    // Columns shared by every CSV: rank, model, organization, GPQA score
+    static void RowPrefix(BufferedWriter& out, int rank, const ModelEntity& m) {
+        out.Integer(rank).Put(',').CsvField(m.name).Put(',').CsvField(m.organization).Put(',')
+           .Fixed(m.final_score, 3).Put(',');
+    }
+public:
+    static void ExportCSV(BufferedWriter& out, const ExportSnapshot& snap, const std::string& type) {
+        const auto& models = snap.registry;
+        
+        if (type == "performance") {
+            out.Put("Rank,Model,Organization,GPQA Score,Input Price,Overall Score\n");
+            int rank = 1;
+            for (size_t idx : snap.overall) {
+                const ModelEntity& m = models[idx];
+                RowPrefix(out, rank++, m);
+                if (m.metrics.price_input_1m >= 999999.0) out.Put("N/A");
+                else out.Fixed(m.metrics.price_input_1m, 6);
+                out.Put(',').Fixed(m.ranks.overall, 2).Put('\n');
+            }
+        } else if (type == "price") {
+            out.Put("Rank,Model,Organization,GPQA Score,Input Price,Price\n");
+            // Models with unknown prices are already filtered out
+            int rank = 1;
+            for (size_t idx : snap.cheapest) {
+                const ModelEntity& m = models[idx];
+                RowPrefix(out, rank++, m);
+                out.Fixed(m.metrics.price_input_1m, 2).Put(',').Fixed(m.metrics.price_input_1m, 2).Put('\n');
+            }
+        } else if (type == "value") {
+            out.Put("Rank,Model,Organization,GPQA Score,Input Price,Value Score\n");
+            // Models with zero or negative value are already filtered out
+            int rank = 1;
+            for (size_t idx : snap.value) {
+                const ModelEntity& m = models[idx];
+                RowPrefix(out, rank++, m);
+                if (m.metrics.price_input_1m >= 999999.0) out.Put("N/A");
+                else out.Fixed(m.metrics.price_input_1m, 2);
+                out.Put(',').Fixed(m.ranks.value, 2).Put('\n');
+            }
+        }
+    }
+    static void ExportLegacyText(BufferedWriter& out, const ExportSnapshot& snap) {
+        out.Put("AI LEADERBOARD V8.5 (Fixed)\n------------------\n");
+        size_t rows = std::min(ExportSnapshot::TEXT_ROWS, snap.overall.size());
+        int rank = 1;
+        for (size_t r = 0; r < rows; ++r) {
+            const ModelEntity& m = snap.registry[snap.overall[r]];
+            out << rank++ << ". " << m.name << " (" << m.ranks.overall*100 << ")\n";
+        }
+    }
+};
+
+// Columnar binary export (format and reader: include/columnar.hpp). Columns
+// carry the same values as the JSON export, in registry order.
+class ColumnarExporter {
+    struct Plan {
+        Columnar::ColumnEntry entry{};
+        std::function<void(BufferedWriter&)> write; // Fixed-width columns: emits entry.data_length bytes
+        std::vector<std::string_view> dict;         // DictString columns
+        std::vector<uint32_t> codes;
+    };
+
+    static Plan Start(const char* name, Columnar::Type type, size_t rows) {
+        Plan p;
+        std::strncpy(p.entry.name, name, sizeof p.entry.name - 1);
+        p.entry.type = static_cast<uint32_t>(type);
+        p.entry.data_length = rows * Columnar::Width(type);
+        return p;
+    }
+
+    template <typename T, typename Get>
+    static Plan Values(const char* name, Columnar::Type type, const std::vector<ModelEntity>& registry, Get get) {
+        Plan p = Start(name, type, registry.size());
+        p.write = [&registry, get](BufferedWriter& out) {
+            for (const auto& m : registry) out.Raw(static_cast<T>(get(m)));
+        };
+        return p;
+    }
+
+    // Dictionary-encoded; `get` must return a view that outlives the export
+    template <typename Get>
+    static Plan Strings(const char* name, const std::vector<ModelEntity>& registry, Get get) {
+        Plan p = Start(name, Columnar::Type::DictString, registry.size());
+        std::unordered_map<std::string_view, uint32_t> ids;
+        p.codes.reserve(registry.size());
+        uint64_t bytes = 0;
+        for (const auto& m : registry) {
+            auto [it, inserted] = ids.emplace(get(m), static_cast<uint32_t>(p.dict.size()));
+            if (inserted) {
+                p.dict.push_back(it->first);
+                bytes += it->first.size();
+            }
+            p.codes.push_back(it->second);
+        }
+        p.entry.dict_length = 4 + 4 * (p.dict.size() + 1) + bytes;
+        return p;
+    }
+
+    static void Pad(BufferedWriter& out, uint64_t written) {
+        for (uint64_t i = written; i < Columnar::Align8(written); ++i) out.Put('\0');
+    }
+
+public:
+    // `out` must have been opened in binary mode
+    static void Write(BufferedWriter& out, const std::vector<ModelEntity>& registry) {
+        using Columnar::Type;
+        auto pct = [](double v) { return std::clamp(v, 0.0, 100.0); };
+        std::vector<Plan> plans;
+        plans.push_back(Strings("name", registry, [](const ModelEntity& m) { return std::string_view(m.name); }));
+        plans.push_back(Strings("org", registry, [](const ModelEntity& m) { return std::string_view(m.organization); }));
+        plans.push_back(Values<double>("metrics.score", Type::Float64, registry, [&](const ModelEntity& m) { return pct(m.final_score * 100.0); }));
+        plans.push_back(Values<double>("metrics.coding", Type::Float64, registry, [&](const ModelEntity& m) { return pct(m.metrics.coding_score * 100.0); }));
+        plans.push_back(Values<double>("metrics.creative", Type::Float64, registry, [&](const ModelEntity& m) { return pct(m.metrics.creative_score * 100.0); }));
+        plans.push_back(Values<double>("metrics.price", Type::Float64, registry, [](const ModelEntity& m) { return m.metrics.price_input_1m; }));
+        plans.push_back(Values<double>("metrics.speed", Type::Float64, registry, [](const ModelEntity& m) { return m.metrics.tokens_per_sec; }));
+        plans.push_back(Values<int32_t>("metrics.recency_bonus", Type::Int32, registry, [](const ModelEntity& m) { return m.metrics.recency_bonus; }));
+        plans.push_back(Values<int32_t>("metrics.days_ago", Type::Int32, registry, [](const ModelEntity& m) { return m.metrics.last_updated_days_ago; }));
+        static const char* RANK_COLUMNS[RANK_FIELD_COUNT] = {"ranks.overall", "ranks.value", "ranks.coding", "ranks.image",
+                                                             "ranks.video", "ranks.speed", "ranks.confidence", "ranks.enterprise"};
+        for (size_t f = 0; f < RANK_FIELD_COUNT; ++f) {
+            RankField field = static_cast<RankField>(f);
+            plans.push_back(Values<double>(RANK_COLUMNS[f], Type::Float64, registry, [&pct, field](const ModelEntity& m) { return pct(RankValue(m.ranks, field)); }));
+        }
+        plans.push_back(Values<double>("meta.confidence", Type::Float64, registry, [](const ModelEntity& m) { return m.confidence_score; }));
+        plans.push_back(Strings("meta.conf_reason", registry, [](const ModelEntity& m) { return std::string_view(m.confidence_reason); }));
+        plans.push_back(Strings("meta.primary_type", registry, [](const ModelEntity& m) { return m.PrimaryType(); }));
+        plans.push_back(Values<uint8_t>("meta.is_open_source", Type::Bool8, registry, [](const ModelEntity& m) { return m.metrics.is_open_source; }));
+        plans.push_back(Values<uint8_t>("meta.is_enterprise", Type::Bool8, registry, [](const ModelEntity& m) { return m.metrics.is_enterprise_ready; }));
+        plans.push_back(Values<uint8_t>("meta.is_image", Type::Bool8, registry, [](const ModelEntity& m) { return m.modalities.count(Modality::Image) > 0; }));
+        plans.push_back(Values<uint8_t>("meta.is_video", Type::Bool8, registry, [](const ModelEntity& m) { return m.modalities.count(Modality::Video) > 0; }));
+        plans.push_back(Values<uint8_t>("meta.is_text", Type::Bool8, registry, [](const ModelEntity& m) { return m.modalities.count(Modality::Text) > 0; }));
+
+        // Lay out the sections, then stream them in file order
+        Columnar::Header header{};
+        std::memcpy(header.magic, Columnar::MAGIC, sizeof header.magic);
+        header.version = Columnar::VERSION;
+        header.byte_order = Columnar::BYTE_ORDER_MARK;
+        header.row_count = registry.size();
+        header.column_count = static_cast<uint32_t>(plans.size());
+        header.directory_offset = sizeof(Columnar::Header);
+        uint64_t pos = Columnar::Align8(header.directory_offset + plans.size() * sizeof(Columnar::ColumnEntry));
+        for (Plan& p : plans) {
+            p.entry.data_offset = pos;
+            pos = Columnar::Align8(pos + p.entry.data_length);
+            if (p.entry.dict_length) {
+                p.entry.dict_offset = pos;
+                pos = Columnar::Align8(pos + p.entry.dict_length);
+            }
+        }
+
+        out.Raw(header);
+        for (const Plan& p : plans) out.Raw(p.entry);
+        Pad(out, header.directory_offset + plans.size() * sizeof(Columnar::ColumnEntry));
+        for (const Plan& p : plans) {
+            if (p.write) p.write(out);
+            else for (uint32_t c : p.codes) out.Raw(c);
+            Pad(out, p.entry.data_length);
+            if (!p.entry.dict_length) continue;
+            out.Raw(static_cast<uint32_t>(p.dict.size()));
+            uint32_t offset = 0;
+            out.Raw(offset);
+            for (std::string_view d : p.dict) out.Raw(offset += static_cast<uint32_t>(d.size()));
+            for (std::string_view d : p.dict) out.Put(d);
+            Pad(out, p.entry.dict_length);
+        }
+    }
+};
+
+// --- Search Index ---
+// Trigram index over model names and organizations for the dashboard's
+// search box. Text is ASCII case-folded; grams are three UTF-8 code points.
+// Each field is indexed with a leading space, so a two-character query can
+// match word starts (" gp"). The page script runs the same lookup as Find().
+class SearchIndex {
+public:
+    struct Entry {
+        size_t model;
+        int view;     // First view whose dashboard shard lists the model, or -1
+        uint32_t row; // Position in that view's default order
+    };
+
+    // Most relevant first: by home view, then leaderboard position, then the
+    // models no shard lists. Postings hold entry numbers, so the first hits
+    // of any query are also the best ranked.
+    std::vector<Entry> entries;
+    std::vector<std::pair<std::string, std::vector<uint32_t>>> grams; // Sorted by gram
+
+    static std::string Fold(std::string_view s) {
+        std::string out;
+        out.reserve(s.size() + 1);
+        out.push_back(' ');
+        for (char c : s) out.push_back(c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c);
+        return out;
+    }
+
+    static SearchIndex Build(const ExportSnapshot& snap) {
+        SearchIndex index;
+        const auto& registry = snap.registry;
+        std::vector<char> listed(registry.size());
+        index.entries.reserve(registry.size());
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            const ExportSnapshot::ViewShard& shard = snap.shards[v];
+            const auto& order = shard.order[static_cast<size_t>(ExportSnapshot::Sort::Default)];
+            for (size_t p = 0; p < order.size(); ++p) {
+                size_t idx = shard.rows[order[p]];
+                if (listed[idx]) continue;
+                listed[idx] = 1;
+                index.entries.push_back({idx, static_cast<int>(v), static_cast<uint32_t>(p)});
+            }
+        }
+        for (size_t idx = 0; idx < registry.size(); ++idx) {
+            if (!listed[idx]) index.entries.push_back({idx, -1, 0});
+        }
+
+        // Grams of up to 8 bytes (every ASCII one) are keyed by their bytes packed
+        // into an integer; UTF-8 text has no NUL bytes, so the zero padding is unambiguous
+        std::unordered_map<uint64_t, std::vector<uint32_t>> packed;
+        std::unordered_map<std::string, std::vector<uint32_t>> wide;
+        packed.reserve(4096);
+        std::vector<size_t> starts;
+        for (uint32_t e = 0; e < index.entries.size(); ++e) {
+            const ModelEntity& m = registry[index.entries[e].model];
+            for (std::string_view field : {std::string_view(m.name), std::string_view(m.organization)}) {
+                std::string text = Fold(field);
+                starts.clear();
+                for (size_t i = 0; i < text.size(); ++i) {
+                    if ((static_cast<unsigned char>(text[i]) & 0xC0) != 0x80) starts.push_back(i);
+                }
+                starts.push_back(text.size());
+                for (size_t i = 0; i + 3 < starts.size(); ++i) {
+                    size_t len = starts[i + 3] - starts[i];
+                    uint64_t key = 0;
+                    if (len <= 8) std::memcpy(&key, text.data() + starts[i], len);
+                    std::vector<uint32_t>& list = len <= 8 ? packed[key] : wide[text.substr(starts[i], len)];
+                    if (list.empty() || list.back() != e) list.push_back(e);
+                }
+            }
+        }
+        index.grams.reserve(packed.size() + wide.size());
+        for (auto& [key, list] : packed) {
+            char bytes[8];
+            std::memcpy(bytes, &key, 8);
+            index.grams.emplace_back(std::string(bytes, strnlen(bytes, 8)), std::move(list));
+        }
+        for (auto& [gram, list] : wide) index.grams.emplace_back(gram, std::move(list));
+        std::sort(index.grams.begin(), index.grams.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        return index;
+    }
+
+    // Entries matching `query` as a substring of the name or organization, best
+    // ranked first. Queries of two code points match word starts only; shorter
+    // ones match nothing.
+    std::vector<uint32_t> Find(const ExportSnapshot& snap, std::string_view query, size_t limit) const {
+        while (!query.empty() && query.front() == ' ') query.remove_prefix(1);
+        while (!query.empty() && query.back() == ' ') query.remove_suffix(1);
+        std::string q = Fold(query).substr(1);
+        std::vector<size_t> starts;
+        for (size_t i = 0; i < q.size(); ++i) {
+            if ((static_cast<unsigned char>(q[i]) & 0xC0) != 0x80) starts.push_back(i);
+        }
+        if (starts.size() < 2) return {};
+        if (starts.size() == 2) {
+            q.insert(q.begin(), ' ');
+            for (size_t& s : starts) s++;
+            starts.insert(starts.begin(), 0);
+        }
+        starts.push_back(q.size());
+
+        std::vector<const std::vector<uint32_t>*> lists;
+        for (size_t i = 0; i + 3 < starts.size(); ++i) {
+            std::string gram = q.substr(starts[i], starts[i + 3] - starts[i]);
+            auto it = std::lower_bound(grams.begin(), grams.end(), gram, [](const auto& g, const std::string& key) { return g.first < key; });
+            if (it == grams.end() || it->first != gram) return {};
+            lists.push_back(&it->second);
+        }
+        std::sort(lists.begin(), lists.end(), [](auto* a, auto* b) { return a->size() < b->size(); });
+
+        std::vector<uint32_t> hits;
+        for (uint32_t e : *lists[0]) {
+            bool all = std::all_of(lists.begin() + 1, lists.end(), [e](auto* l) { return std::binary_search(l->begin(), l->end(), e); });
+            if (!all) continue;
+            // Consecutive grams can straddle a gap the query does not have
+            const ModelEntity& m = snap.registry[entries[e].model];
+            if (Fold(m.name).find(q) == std::string::npos && Fold(m.organization).find(q) == std::string::npos) continue;
+            hits.push_back(e);
+            if (hits.size() == limit) break;
+        }
+        return hits;
+    }
+
+    // {"views":[...],"name":[...],"orgs":[...],"org":[...],"view":[...],"row":[...],"grams":{...}}
+    // with organizations dictionary-coded and each posting list delta-coded
+    void Write(BufferedWriter& out, const ExportSnapshot& snap) const {
+        const auto& registry = snap.registry;
+        out.Put("{\"views\":[");
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            if (v) out.Put(',');
+            out.JsonString(Views::ALL[v].key);
+        }
+        out.Put("],\"name\":[");
+        for (size_t e = 0; e < entries.size(); ++e) {
+            if (e) out.Put(',');
+            out.JsonString(registry[entries[e].model].name);
+        }
+        std::unordered_map<std::string_view, size_t> orgCode;
+        std::vector<std::string_view> orgs;
+        std::vector<size_t> codes;
+        codes.reserve(entries.size());
+        for (const Entry& entry : entries) {
+            std::string_view org = registry[entry.model].organization;
+            auto [it, added] = orgCode.try_emplace(org, orgs.size());
+            if (added) orgs.push_back(org);
+            codes.push_back(it->second);
+        }
+        out.Put("],\"orgs\":[");
+        for (size_t i = 0; i < orgs.size(); ++i) {
+            if (i) out.Put(',');
+            out.JsonString(orgs[i]);
+        }
+        out.Put("],\"org\":[");
+        for (size_t e = 0; e < codes.size(); ++e) {
+            if (e) out.Put(',');
+            out.Integer(static_cast<long long>(codes[e]));
+        }
+        out.Put("],\"view\":[");
+        for (size_t e = 0; e < entries.size(); ++e) {
+            if (e) out.Put(',');
+            out.Integer(entries[e].view);
+        }
+        out.Put("],\"row\":[");
+        for (size_t e = 0; e < entries.size(); ++e) {
+            if (e) out.Put(',');
+            out.Integer(entries[e].row);
+        }
+        out.Put("],\"grams\":{");
+        for (size_t g = 0; g < grams.size(); ++g) {
+            if (g) out.Put(',');
+            out.JsonString(grams[g].first).Put(":[");
+            uint32_t prev = 0;
+            for (size_t i = 0; i < grams[g].second.size(); ++i) {
+                if (i) out.Put(',');
+                out.Integer(grams[g].second[i] - prev);
+                prev = grams[g].second[i];
+            }
+            out.Put(']');
+        }
+        out.Put("}}");
+    }
+};
+
+// --- Dashboard Assets ---
+// The dashboard ships as one file with no third-party requests: the Tailwind
+// utilities it uses are precompiled below and purged against the page at
+// export time, and the two ecosystem charts are drawn by a small canvas
+// routine instead of Chart.js. Fonts fall back to the system stacks.
+namespace DashboardAssets {
+    // Subset of Tailwind's preflight the page relies on
+    constexpr std::string_view PREFLIGHT = R"CSS(        *, ::before, ::after { box-sizing: border-box; border: 0 solid #e5e7eb; }
+        html { line-height: 1.5; -webkit-text-size-adjust: 100%; tab-size: 4; }
+        body { margin: 0; line-height: inherit; }
+        h1, h2, h3, p { margin: 0; }
+        h1, h2, h3 { font-size: inherit; font-weight: inherit; }
+        table { text-indent: 0; border-color: inherit; border-collapse: collapse; }
+        button, input, select { font-family: inherit; font-size: 100%; font-weight: inherit; line-height: inherit; color: inherit; margin: 0; padding: 0; text-transform: none; }
+        button { -webkit-appearance: button; background-color: transparent; background-image: none; cursor: pointer; }
+        input::placeholder { opacity: 1; color: #9ca3af; }
+        [type='search'] { -webkit-appearance: textfield; outline-offset: -2px; }
+        canvas { display: block; vertical-align: middle; }
+)CSS";
+
+    struct Utility {
+        std::string_view name; // Class name as written in the markup
+        std::string_view css;  // Compiled rule; empty for marker classes such as "group"
+    };
+
+    // Tailwind v3 output for every utility the dashboard uses, in Tailwind's
+    // order so later rules win the same way (hidden after flex, shadow colors
+    // after shadow sizes, variants last)
+    constexpr Utility UTILITIES[] = {
+        {"group", ""},
+        {"sticky", ".sticky{position:sticky}"},
+        {"absolute", ".absolute{position:absolute}"},
+        {"relative", ".relative{position:relative}"},
+        {"bottom-full", ".bottom-full{bottom:100%}"},
+        {"left-1/2", R"(.left-1\/2{left:50%})"},
+        {"right-0", ".right-0{right:0}"},
+        {"top-0", ".top-0{top:0}"},
+        {"z-50", ".z-50{z-index:50}"},
+        {"mx-auto", ".mx-auto{margin-left:auto;margin-right:auto}"},
+        {"mb-1", ".mb-1{margin-bottom:.25rem}"},
+        {"mb-2", ".mb-2{margin-bottom:.5rem}"},
+        {"mb-3", ".mb-3{margin-bottom:.75rem}"},
+        {"mb-4", ".mb-4{margin-bottom:1rem}"},
+        {"mb-6", ".mb-6{margin-bottom:1.5rem}"},
+        {"ml-2", ".ml-2{margin-left:.5rem}"},
+        {"mt-1", ".mt-1{margin-top:.25rem}"},
+        {"block", ".block{display:block}"},
+        {"flex", ".flex{display:flex}"},
+        {"grid", ".grid{display:grid}"},
+        {"hidden", ".hidden{display:none}"},
+        {"h-12", ".h-12{height:3rem}"},
+        {"max-h-96", ".max-h-96{max-height:24rem}"},
+        {"min-h-screen", ".min-h-screen{min-height:100vh}"},
+        {"w-12", ".w-12{width:3rem}"},
+        {"w-16", ".w-16{width:4rem}"},
+        {"w-40", ".w-40{width:10rem}"},
+        {"w-full", ".w-full{width:100%}"},
+        {"w-max", ".w-max{width:max-content}"},
+        {"max-w-7xl", ".max-w-7xl{max-width:80rem}"},
+        {"max-w-xs", ".max-w-xs{max-width:20rem}"},
+        {"flex-1", ".flex-1{flex:1 1 0%}"},
+        {"border-collapse", ".border-collapse{border-collapse:collapse}"},
+        {"-translate-x-1/2", R"(.-translate-x-1\/2{transform:translateX(-50%)})"},
+        {"cursor-help", ".cursor-help{cursor:help}"},
+        {"cursor-pointer", ".cursor-pointer{cursor:pointer}"},
+        {"grid-cols-1", ".grid-cols-1{grid-template-columns:repeat(1,minmax(0,1fr))}"},
+        {"flex-col", ".flex-col{flex-direction:column}"},
+        {"flex-wrap", ".flex-wrap{flex-wrap:wrap}"},
+        {"items-end", ".items-end{align-items:flex-end}"},
+        {"items-center", ".items-center{align-items:center}"},
+        {"justify-center", ".justify-center{justify-content:center}"},
+        {"justify-between", ".justify-between{justify-content:space-between}"},
+        {"gap-1.5", R"(.gap-1\.5{gap:.375rem})"},
+        {"gap-2", ".gap-2{gap:.5rem}"},
+        {"gap-3", ".gap-3{gap:.75rem}"},
+        {"gap-4", ".gap-4{gap:1rem}"},
+        {"gap-5", ".gap-5{gap:1.25rem}"},
+        {"gap-6", ".gap-6{gap:1.5rem}"},
+        {"divide-y", ".divide-y>:not([hidden])~:not([hidden]){border-top-width:1px;border-bottom-width:0}"},
+        {"divide-white/5", R"(.divide-white\/5>:not([hidden])~:not([hidden]){border-color:rgb(255 255 255/.05)})"},
+        {"overflow-hidden", ".overflow-hidden{overflow:hidden}"},
+        {"overflow-x-auto", ".overflow-x-auto{overflow-x:auto}"},
+        {"overflow-y-auto", ".overflow-y-auto{overflow-y:auto}"},
+        {"whitespace-nowrap", ".whitespace-nowrap{white-space:nowrap}"},
+        {"rounded", ".rounded{border-radius:.25rem}"},
+        {"rounded-lg", ".rounded-lg{border-radius:.5rem}"},
+        {"rounded-xl", ".rounded-xl{border-radius:.75rem}"},
+        {"border", ".border{border-width:1px}"},
+        {"border-b", ".border-b{border-bottom-width:1px}"},
+        {"border-green-500/20", R"(.border-green-500\/20{border-color:rgb(34 197 94/.2)})"},
+        {"border-slate-700", ".border-slate-700{border-color:#334155}"},
+        {"border-white/10", R"(.border-white\/10{border-color:rgb(255 255 255/.1)})"},
+        {"border-white/5", R"(.border-white\/5{border-color:rgb(255 255 255/.05)})"},
+        {"border-white/[0.03]", R"(.border-white\/\[0\.03\]{border-color:rgb(255 255 255/.03)})"},
+        {"bg-amber-500", ".bg-amber-500{background-color:#f59e0b}"},
+        {"bg-emerald-500", ".bg-emerald-500{background-color:#10b981}"},
+        {"bg-green-500/10", R"(.bg-green-500\/10{background-color:rgb(34 197 94/.1)})"},
+        {"bg-rose-500", ".bg-rose-500{background-color:#f43f5e}"},
+        {"bg-slate-800", ".bg-slate-800{background-color:#1e293b}"},
+        {"bg-slate-900", ".bg-slate-900{background-color:#0f172a}"},
+        {"bg-slate-900/50", R"(.bg-slate-900\/50{background-color:rgb(15 23 42/.5)})"},
+        {"bg-transparent", ".bg-transparent{background-color:transparent}"},
+        {"bg-white/[0.02]", R"(.bg-white\/\[0\.02\]{background-color:rgb(255 255 255/.02)})"},
+        {"bg-gradient-to-br", ".bg-gradient-to-br{background-image:linear-gradient(to bottom right,var(--tw-gradient-stops))}"},
+        {"from-blue-600", ".from-blue-600{--tw-gradient-from:#2563eb;--tw-gradient-to:rgb(37 99 235/0);--tw-gradient-stops:var(--tw-gradient-from),var(--tw-gradient-to)}"},
+        {"to-indigo-700", ".to-indigo-700{--tw-gradient-to:#4338ca}"},
+        {"p-1", ".p-1{padding:.25rem}"},
+        {"p-1.5", R"(.p-1\.5{padding:.375rem})"},
+        {"p-3", ".p-3{padding:.75rem}"},
+        {"p-4", ".p-4{padding:1rem}"},
+        {"p-5", ".p-5{padding:1.25rem}"},
+        {"p-6", ".p-6{padding:1.5rem}"},
+        {"p-8", ".p-8{padding:2rem}"},
+        {"px-1.5", R"(.px-1\.5{padding-left:.375rem;padding-right:.375rem})"},
+        {"px-2", ".px-2{padding-left:.5rem;padding-right:.5rem}"},
+        {"px-3", ".px-3{padding-left:.75rem;padding-right:.75rem}"},
+        {"px-6", ".px-6{padding-left:1.5rem;padding-right:1.5rem}"},
+        {"py-0.5", R"(.py-0\.5{padding-top:.125rem;padding-bottom:.125rem})"},
+        {"py-1.5", R"(.py-1\.5{padding-top:.375rem;padding-bottom:.375rem})"},
+        {"py-2", ".py-2{padding-top:.5rem;padding-bottom:.5rem}"},
+        {"py-5", ".py-5{padding-top:1.25rem;padding-bottom:1.25rem}"},
+        {"text-left", ".text-left{text-align:left}"},
+        {"text-center", ".text-center{text-align:center}"},
+        {"text-right", ".text-right{text-align:right}"},
+        {"font-mono", ".font-mono{font-family:'JetBrains Mono',ui-monospace,SFMono-Regular,Menlo,Consolas,monospace}"},
+        {"text-2xl", ".text-2xl{font-size:1.5rem;line-height:2rem}"},
+        {"text-[10px]", R"(.text-\[10px\]{font-size:10px})"},
+        {"text-[9px]", R"(.text-\[9px\]{font-size:9px})"},
+        {"text-lg", ".text-lg{font-size:1.125rem;line-height:1.75rem}"},
+        {"text-sm", ".text-sm{font-size:.875rem;line-height:1.25rem}"},
+        {"text-xs", ".text-xs{font-size:.75rem;line-height:1rem}"},
+        {"font-bold", ".font-bold{font-weight:700}"},
+        {"font-extrabold", ".font-extrabold{font-weight:800}"},
+        {"font-medium", ".font-medium{font-weight:500}"},
+        {"font-normal", ".font-normal{font-weight:400}"},
+        {"font-semibold", ".font-semibold{font-weight:600}"},
+        {"uppercase", ".uppercase{text-transform:uppercase}"},
+        {"normal-case", ".normal-case{text-transform:none}"},
+        {"leading-relaxed", ".leading-relaxed{line-height:1.625}"},
+        {"tracking-[0.2em]", R"(.tracking-\[0\.2em\]{letter-spacing:.2em})"},
+        {"tracking-tight", ".tracking-tight{letter-spacing:-.025em}"},
+        {"tracking-wider", ".tracking-wider{letter-spacing:.05em}"},
+        {"text-blue-400", ".text-blue-400{color:#60a5fa}"},
+        {"text-emerald-400", ".text-emerald-400{color:#34d399}"},
+        {"text-green-400", ".text-green-400{color:#4ade80}"},
+        {"text-rose-400", ".text-rose-400{color:#fb7185}"},
+        {"text-slate-100", ".text-slate-100{color:#f1f5f9}"},
+        {"text-slate-200", ".text-slate-200{color:#e2e8f0}"},
+        {"text-slate-300", ".text-slate-300{color:#cbd5e1}"},
+        {"text-slate-400", ".text-slate-400{color:#94a3b8}"},
+        {"text-slate-500", ".text-slate-500{color:#64748b}"},
+        {"text-slate-600", ".text-slate-600{color:#475569}"},
+        {"text-white", ".text-white{color:#fff}"},
+        {"shadow-2xl", ".shadow-2xl{--tw-shadow:0 25px 50px -12px rgb(0 0 0/.25);--tw-shadow-colored:0 25px 50px -12px var(--tw-shadow-color);box-shadow:var(--tw-shadow)}"},
+        {"shadow-[0_0_8px_rgba(0,0,0,0.5)]", R"(.shadow-\[0_0_8px_rgba\(0\,0\,0\,0\.5\)\]{--tw-shadow:0 0 8px rgba(0,0,0,0.5);--tw-shadow-colored:0 0 8px var(--tw-shadow-color);box-shadow:var(--tw-shadow)})"},
+        {"shadow-lg", ".shadow-lg{--tw-shadow:0 10px 15px -3px rgb(0 0 0/.1),0 4px 6px -4px rgb(0 0 0/.1);--tw-shadow-colored:0 10px 15px -3px var(--tw-shadow-color),0 4px 6px -4px var(--tw-shadow-color);box-shadow:var(--tw-shadow)}"},
+        {"shadow-xl", ".shadow-xl{--tw-shadow:0 20px 25px -5px rgb(0 0 0/.1),0 8px 10px -6px rgb(0 0 0/.1);--tw-shadow-colored:0 20px 25px -5px var(--tw-shadow-color),0 8px 10px -6px var(--tw-shadow-color);box-shadow:var(--tw-shadow)}"},
+        {"shadow-black/50", R"(.shadow-black\/50{--tw-shadow-color:rgb(0 0 0/.5);--tw-shadow:var(--tw-shadow-colored)})"},
+        {"shadow-blue-500/30", R"(.shadow-blue-500\/30{--tw-shadow-color:rgb(59 130 246/.3);--tw-shadow:var(--tw-shadow-colored)})"},
+        {"drop-shadow-md", ".drop-shadow-md{filter:drop-shadow(0 4px 3px rgb(0 0 0/.07)) drop-shadow(0 2px 2px rgb(0 0 0/.06))}"},
+        {"transition-colors", ".transition-colors{transition-property:color,background-color,border-color,text-decoration-color,fill,stroke;transition-timing-function:cubic-bezier(.4,0,.2,1);transition-duration:150ms}"},
+        {"last:border-0", R"(.last\:border-0:last-child{border-width:0})"},
+        {"hover:bg-slate-800", R"(.hover\:bg-slate-800:hover{background-color:#1e293b})"},
+        {"hover:bg-white/[0.02]", R"(.hover\:bg-white\/\[0\.02\]:hover{background-color:rgb(255 255 255/.02)})"},
+        {"focus:outline-none", R"(.focus\:outline-none:focus{outline:2px solid transparent;outline-offset:2px})"},
+        {"group-hover:text-blue-500", R"(.group:hover .group-hover\:text-blue-500{color:#3b82f6})"},
+        {"md:w-80", R"(@media (min-width:768px){.md\:w-80{width:20rem}})"},
+        {"md:flex-row", R"(@media (min-width:768px){.md\:flex-row{flex-direction:row}})"},
+        {"lg:grid-cols-2", R"(@media (min-width:1024px){.lg\:grid-cols-2{grid-template-columns:repeat(2,minmax(0,1fr))}})"},
+    };
+
+    // Rules every generated page shares: page colors, cards and the confidence bar
+    constexpr std::string_view THEME = R"CSS(        body { background: #020617; color: #f8fafc; font-family: 'Outfit', ui-sans-serif, system-ui, -apple-system, 'Segoe UI', Roboto, sans-serif; }
+        .glass { background: rgba(15, 23, 42, 0.6); backdrop-filter: blur(12px); border: 1px solid rgba(255,255,255,0.05); }
+        .conf-bar-bg { background: rgba(51, 65, 85, 0.3); border-radius: 99px; height: 8px; width: 100%; overflow: hidden; }
+        .conf-bar-fill { height: 100%; border-radius: 99px; }
+)CSS";
+
+    // True if `markup` uses `name` as a whole class token, in an attribute or a script string
+    inline bool Mentions(std::string_view markup, std::string_view name) {
+        auto edge = [](char c) { return c == ' ' || c == '"' || c == '\'' || c == '`' || c == '\n'; };
+        for (size_t at = markup.find(name); at != std::string_view::npos; at = markup.find(name, at + 1)) {
+            size_t end = at + name.size();
+            if (at > 0 && edge(markup[at - 1]) && end < markup.size() && edge(markup[end])) return true;
+        }
+        return false;
+    }
+
+    // Preflight plus the utilities `markup` mentions, one rule per line
+    inline std::string Stylesheet(const std::vector<std::string_view>& markup) {
+        std::string css(PREFLIGHT);
+        for (const Utility& u : UTILITIES) {
+            if (u.css.empty()) continue;
+            for (std::string_view m : markup) {
+                if (!Mentions(m, u.name)) continue;
+                css.append("        ").append(u.css).append("\n");
+                break;
+            }
+        }
+        return css;
+    }
+
+    // Class selector for `name`: everything but letters, digits, '-' and '_' escaped
+    inline std::string Selector(std::string_view name) {
+        std::string sel = ".";
+        for (char c : name) {
+            if (!(std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_')) sel.push_back('\\');
+            sel.push_back(c);
+        }
+        return sel;
+    }
+
+    // Classes in the class attributes of `markup` that no selector in `css`, the
+    // complete stylesheet the page ships, mentions
+    inline std::vector<std::string> Unstyled(const std::vector<std::string_view>& markup, std::string_view css) {
+        std::vector<std::string> missing;
+        constexpr std::string_view ATTR = "class=\"";
+        for (std::string_view piece : markup) {
+            for (size_t at = piece.find(ATTR); at != std::string_view::npos; at = piece.find(ATTR, at)) {
+                at += ATTR.size();
+                std::istringstream names(std::string(piece.substr(at, piece.find('"', at) - at)));
+                std::string name;
+                while (names >> name) {
+                    std::string sel = Selector(name);
+                    bool known = false;
+                    for (size_t rule = css.find(sel); !known && rule != std::string_view::npos; rule = css.find(sel, rule + 1)) {
+                        char next = rule + sel.size() < css.size() ? css[rule + sel.size()] : ' ';
+                        known = !(std::isalnum(static_cast<unsigned char>(next)) || next == '-' || next == '_' || next == '\\');
+                    }
+                    if (!known && std::find(missing.begin(), missing.end(), name) == missing.end()) missing.push_back(name);
+                }
+            }
+        }
+        return missing;
+    }
+
+    // Doughnut (with legend) and horizontal bar charts on a canvas, with hover
+    // tooltips. Each chart redraws when its container is resized, which also
+    // covers the ecosystem tab going from hidden to shown.
+    constexpr std::string_view CHARTS = R"JS(        const MiniChart = (() => {
+            const FONT = "'Outfit', ui-sans-serif, system-ui, sans-serif";
+            const tip = document.createElement('div');
+            tip.className = 'chart-tip';
+            tip.append(document.createElement('b'), document.createElement('span'));
+            document.body.appendChild(tip);
+
+            function showTip(e, title, text) {
+                tip.firstChild.textContent = title;
+                tip.lastChild.textContent = text;
+                tip.style.display = 'block';
+                tip.style.left = `${Math.min(e.clientX + 14, window.innerWidth - tip.offsetWidth - 8)}px`;
+                tip.style.top = `${e.clientY + 14}px`;
+            }
+
+            // draw(ctx, width, height, active) paints the chart in CSS pixels and
+            // returns hit(x, y) -> { index, title, text } or null
+            function mount(canvas, draw) {
+                const ctx = canvas.getContext('2d');
+                let hit = () => null, active = -1;
+                function paint() {
+                    const box = canvas.parentElement.getBoundingClientRect();
+                    if (!box.width || !box.height) return;
+                    const dpr = window.devicePixelRatio || 1;
+                    canvas.width = Math.round(box.width * dpr);
+                    canvas.height = Math.round(box.height * dpr);
+                    canvas.style.width = `${box.width}px`;
+                    canvas.style.height = `${box.height}px`;
+                    ctx.setTransform(dpr, 0, 0, dpr, 0, 0);
+                    hit = draw(ctx, box.width, box.height, active);
+                }
+                canvas.addEventListener('mousemove', e => {
+                    const r = canvas.getBoundingClientRect();
+                    const h = hit(e.clientX - r.left, e.clientY - r.top);
+                    const index = h ? h.index : -1;
+                    if (index !== active) { active = index; paint(); }
+                    if (h) showTip(e, h.title, h.text); else tip.style.display = 'none';
+                });
+                canvas.addEventListener('mouseleave', () => { active = -1; paint(); tip.style.display = 'none'; });
+                new ResizeObserver(paint).observe(canvas.parentElement);
+            }
+
+            function doughnut(canvas, labels, values, colors) {
+                const total = values.reduce((a, b) => a + b, 0) || 1;
+                const pct = v => ((v / total) * 100).toFixed(1);
+                mount(canvas, (ctx, w, h, active) => {
+                    // Legend on the right, in as many columns as it needs
+                    ctx.font = `700 13px ${FONT}`;
+                    const items = labels.map((l, i) => `${l}: ${pct(values[i])}%`);
+                    const lineH = 28, perCol = Math.max(1, Math.floor((h - 16) / lineH));
+                    const colW = Math.max(0, ...items.map(t => ctx.measureText(t).width)) + 30;
+                    const legendW = Math.min(w * 0.5, Math.ceil(items.length / perCol) * colW);
+                    const rows = Math.min(perCol, items.length);
+                    const legendX = w - legendW, legendY = (h - rows * lineH) / 2;
+                    ctx.textBaseline = 'middle';
+                    items.forEach((t, i) => {
+                        const x = legendX + Math.floor(i / perCol) * colW, y = legendY + (i % perCol) * lineH + lineH / 2;
+                        if (x + colW > w + 30) return;
+                        ctx.beginPath();
+                        ctx.arc(x + 6, y, 6, 0, 2 * Math.PI);
+                        ctx.fillStyle = colors[i % colors.length];
+                        ctx.fill();
+                        ctx.strokeStyle = '#ffffff';
+                        ctx.lineWidth = 1;
+                        ctx.stroke();
+                        ctx.fillStyle = '#ffffff';
+                        ctx.fillText(t, x + 18, y);
+                    });
+
+                    const cx = (w - legendW) / 2, cy = h / 2;
+                    const outer = Math.max(0, Math.min(cx, cy) - 16), inner = outer * 0.65;
+                    const angles = [];
+                    let a = -Math.PI / 2;
+                    values.forEach((v, i) => {
+                        const end = a + (v / total) * 2 * Math.PI;
+                        const r = i === active ? outer + 12 : outer;
+                        ctx.beginPath();
+                        ctx.arc(cx, cy, r, a, end);
+                        ctx.arc(cx, cy, inner, end, a, true);
+                        ctx.closePath();
+                        ctx.fillStyle = colors[i % colors.length];
+                        ctx.fill();
+                        ctx.strokeStyle = '#020617';
+                        ctx.lineWidth = i === active ? 3 : 2;
+                        ctx.stroke();
+                        angles.push(end);
+                        a = end;
+                    });
+                    return (x, y) => {
+                        const d = Math.hypot(x - cx, y - cy);
+                        if (d < inner || d > outer + 12) return null;
+                        let t = Math.atan2(y - cy, x - cx);
+                        if (t < -Math.PI / 2) t += 2 * Math.PI;
+                        const i = angles.findIndex(end => t <= end);
+                        if (i < 0) return null;
+                        return { index: i, title: labels[i], text: `${labels[i]}: ${pct(values[i])}% (Avg Score: ${values[i].toFixed(2)})` };
+                    };
+                });
+            }
+
+            function bar(canvas, labels, values, max) {
+                mount(canvas, (ctx, w, h, active) => {
+                    ctx.font = `600 11px ${FONT}`;
+                    const left = Math.min(w * 0.4, Math.max(0, ...labels.map(l => ctx.measureText(l).width)) + 12);
+                    const right = w - 12, top = 8, bottom = h - 24;
+                    const plotW = Math.max(1, right - left), band = (bottom - top) / Math.max(1, labels.length);
+                    const step = [1, 2, 2.5, 5, 10].find(s => plotW / (max / s) >= 36) || max;
+
+                    ctx.font = `11px ${FONT}`;
+                    ctx.textAlign = 'center';
+                    ctx.textBaseline = 'top';
+                    for (let v = 0; v <= max + 1e-9; v += step) {
+                        const x = left + (v / max) * plotW;
+                        ctx.fillStyle = 'rgba(255,255,255,0.05)';
+                        ctx.fillRect(Math.round(x), top, 1, bottom - top);
+                        ctx.fillStyle = '#94a3b8';
+                        ctx.fillText(String(v), x, bottom + 6);
+                    }
+
+                    ctx.font = `600 11px ${FONT}`;
+                    ctx.textAlign = 'right';
+                    ctx.textBaseline = 'middle';
+                    const thickness = band * 0.72;
+                    labels.forEach((l, i) => {
+                        const y = top + i * band + (band - thickness) / 2;
+                        const len = (Math.min(Math.max(values[i], 0), max) / max) * plotW;
+                        ctx.beginPath();
+                        if (ctx.roundRect) ctx.roundRect(left, y, len, thickness, Math.min(6, len / 2, thickness / 2));
+                        else ctx.rect(left, y, len, thickness);
+                        ctx.fillStyle = i === active ? '#60a5fa' : '#3b82f6';
+                        ctx.fill();
+                        ctx.strokeStyle = '#60a5fa';
+                        ctx.lineWidth = 1;
+                        ctx.stroke();
+                        ctx.fillStyle = '#cbd5e1';
+                        ctx.fillText(l, left - 8, top + i * band + band / 2);
+                    });
+                    ctx.textAlign = 'start';
+                    return (x, y) => {
+                        const i = Math.floor((y - top) / band);
+                        if (x < left || x > right || i < 0 || i >= labels.length) return null;
+                        return { index: i, title: labels[i], text: `Avg Score: ${values[i].toFixed(2)}` };
+                    };
+                });
+            }
+
+            return { doughnut, bar };
+        })();
+)JS";
+}
 
 // --- Dashboard View (V8.5 UI Overhaul) ---
+// The page is a small shell: model rows live in one shard script per view,
+// output/shards/<view>.<content hash>.js, fetched when that tab is first
+// opened; the search index is one more, fetched when the search box is first
+// used. Script tags (not fetch) so the page also works from file://.
+// Styles and the app script are output/assets/app.<content hash>.{css,js},
+// which only change with the program; the rest of the page's data is
+// output/shards/page.<content hash>.js. output/sw.js caches every hashed file
+// for returning viewers, so a refresh costs them only the files that changed.
 class DashboardView {
 public:
-    static void Render(const std::string& jsonData) {
-        Utils::EnsureDirectoryExists(Config::OUTPUT_DIR);
-        std::ofstream html(Config::OUTPUT_DIR + "/leaderboard.html");
-        html << R"HTML(<!DOCTYPE html>
+    static constexpr const char* SHARD_DIR = "shards";
+    static constexpr const char* ASSET_DIR = "assets";
+    static constexpr const char* WORKER = "sw.js";
+    static constexpr const char* SEARCH_KEY = "search"; // Shard key of the search index
+
+    struct ShardFile {
+        const char* view; // View key, or SEARCH_KEY
+        std::string file; // Relative to the output directory
+    };
+
+    // Hashed files the page links directly, relative to the output directory
+    struct PageFiles {
+        std::string style, script, data;
+    };
+
+    // Writes every view's shard, and the search index, into `outputDir`/shards.
+    // `pages` holds each registry model's detail page link, relative to the
+    // output directory; empty when there are no model pages to link.
+    // An unchanged shard keeps its name and contents, so AtomicFile leaves it untouched.
+    static std::vector<ShardFile> WriteShards(const ExportSnapshot& snap, const std::string& outputDir,
+                                              const std::vector<std::string>& pages, bool compress = false,
+                                              PublishTally* tally = nullptr) {
+        Utils::EnsureDirectoryExists(outputDir + "/" + SHARD_DIR);
+        std::vector<ShardFile> files;
+        std::string text, columns;
+        auto publish = [&](const char* key) {
+            files.push_back({key, Publish(outputDir, SHARD_DIR, key, ".js", text, compress, tally)});
+        };
+
+        // The index only reads the snapshot, so it is built while the view shards are written
+        std::optional<SearchIndex> search;
+        std::thread indexer([&] { search.emplace(SearchIndex::Build(snap)); });
+        try {
+            for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                const char* view = Views::ALL[v].key;
+                text.clear();
+                {
+                    BufferedWriter out(&text);
+                    WriteViewShard(out, snap, v, pages, columns);
+                }
+                publish(view);
+            }
+        } catch (...) {
+            indexer.join();
+            throw;
+        }
+        indexer.join();
+
+        text.clear();
+        {
+            BufferedWriter out(&text);
+            out.Put("CrossBench.loadShard(\"").Put(SEARCH_KEY).Put("\",");
+            search->Write(out, snap);
+            out.Put(");\n");
+        }
+        publish(SEARCH_KEY);
+        return files;
+    }
+
+    // Writes the stylesheet and app script into `outputDir`/assets and the
+    // page data (shard names, ecosystem figures) into `outputDir`/shards
+    static PageFiles WritePageFiles(const ExportSnapshot& snap, const std::string& outputDir, const std::vector<ShardFile>& shards,
+                                    bool compress = false, PublishTally* tally = nullptr) {
+        // Fixed at compile time, so one concatenation serves every export
+        static const std::string script = std::string(DashboardAssets::CHARTS).append(PAGE_SCRIPT);
+        Utils::EnsureDirectoryExists(outputDir + "/" + ASSET_DIR);
+        PageFiles files;
+        files.style = Publish(outputDir, ASSET_DIR, "app", ".css", Style(), compress, tally);
+        files.script = Publish(outputDir, ASSET_DIR, "app", ".js", script, compress, tally);
+        std::string data;
+        {
+            BufferedWriter out(&data);
+            WritePageData(out, snap, shards);
+        }
+        files.data = Publish(outputDir, SHARD_DIR, "page", ".js", data, compress, tally);
+        return files;
+    }
+
+    // Writes `outputDir`/sw.js for the current set of hashed files. Hashed
+    // files are served from the browser's cache once fetched, the page
+    // network-first; on activation the worker drops files no longer listed.
+    static void WriteWorker(const std::string& outputDir, const std::vector<ShardFile>& shards, const PageFiles& files,
+                            bool compress = false, PublishTally* tally = nullptr) {
+        std::string path = outputDir + "/" + WORKER;
+        BufferedWriter out(path, std::ios::out, tally);
+        if (compress) Compression::AttachSiblings(out, path, tally);
+        out << "// Generated by CrossBench with leaderboard.html; lists the files that page uses\n";
+        out << "const SHELL = [";
+        out.JsonString(files.style).Put(',').JsonString(files.script).Put(',').JsonString(files.data);
+        out << "];\nconst SHARDS = [";
+        for (size_t i = 0; i < shards.size(); ++i) {
+            if (i) out.Put(',');
+            out.JsonString(shards[i].file);
+        }
+        out << "];\n" << WORKER_SCRIPT;
+        if (!out.Close()) throw std::runtime_error("cannot write " + path);
+    }
+
+    // Removes hashed files the current page no longer references. Call once
+    // the new page is in place, so a page being opened never loses its files.
+    static void PruneFiles(const std::string& outputDir, const std::vector<ShardFile>& shards, const PageFiles& files) {
+        std::unordered_set<std::string> live{files.style, files.script, files.data};
+        for (const auto& f : shards) live.insert(f.file);
+        std::error_code ec;
+        for (const char* dir : {SHARD_DIR, ASSET_DIR}) {
+            for (const auto& entry : fs::directory_iterator(outputDir + "/" + dir, ec)) {
+                std::string file = entry.path().filename().string();
+                // Siblings (.gz, .zst) go with their file
+                for (std::string_view ext : {".gz", ".zst"}) {
+                    if (file.size() > ext.size() && file.compare(file.size() - ext.size(), ext.size(), ext) == 0) file.resize(file.size() - ext.size());
+                }
+                bool hashed = file.size() > 4 && (file.compare(file.size() - 3, 3, ".js") == 0 || file.compare(file.size() - 4, 4, ".css") == 0);
+                if (hashed && !live.count(std::string(dir) + "/" + file)) fs::remove(entry.path(), ec);
+            }
+        }
+    }
+
+    // Leading Overall rows rendered into the page, so the table has content
+    // before any script or shard loads; the script adopts them as its first rows
+    static constexpr size_t SERVER_ROWS = 20;
+
+    static void Render(BufferedWriter& html, const ExportSnapshot& snap, const PageFiles& files, const std::vector<std::string>& pages) {
+        html << PAGE_HEAD << "    <link rel=\"stylesheet\" href=\"" << files.style << "\">\n" << PAGE_BODY;
+        const ExportSnapshot::ViewShard& overall = snap.shards[static_cast<size_t>(ViewId::Overall)];
+        const std::vector<uint32_t>& order = overall.order[static_cast<size_t>(ExportSnapshot::Sort::Default)];
+        for (size_t p = 0; p < std::min(order.size(), SERVER_ROWS); ++p) {
+            size_t idx = overall.rows[order[p]];
+            WriteRow(html, &snap.registry[idx], p + 1, pages.empty() ? nullptr : &pages[idx]);
+        }
+        html << PAGE_BODY_END << RowTemplate() << PAGE_TEMPLATES;
+        // Data before the app: the app script reads its constants as it starts
+        html << "    <script src=\"" << files.data << "\"></script>\n";
+        html << "    <script src=\"" << files.script << "\"></script>\n" << PAGE_END;
+    }
+
+    // Class names the page markup uses that the shipped stylesheet has no rule for
+    static std::vector<std::string> UnstyledClasses() { return DashboardAssets::Unstyled(Markup(), Style()); }
+
+private:
+    // Every piece of page text that can carry a class name; the stylesheet
+    // purge and UnstyledClasses() both read this list
+    static const std::vector<std::string_view>& Markup() {
+        static const std::vector<std::string_view> pieces = {PAGE_BODY, PAGE_BODY_END, RowTemplate(), PAGE_TEMPLATES, PAGE_SCRIPT};
+        return pieces;
+    }
+
+    // Purged utilities, THEME and the page rules; fixed at compile time, so one purge serves every export
+    static const std::string& Style() {
+        static const std::string css = DashboardAssets::Stylesheet(Markup()).append(DashboardAssets::THEME).append(PAGE_STYLE);
+        return css;
+    }
+
+    // Writes `text` to `outputDir`/`dir`/<stem>.<content hash><ext>; returns
+    // the path relative to `outputDir`. An unchanged file keeps its name and
+    // contents, so AtomicFile leaves it untouched.
+    static std::string Publish(const std::string& outputDir, const char* dir, const char* stem, const char* ext,
+                               std::string_view text, bool compress, PublishTally* tally) {
+        std::string file = std::string(dir) + "/" + stem + "." + Utils::HexDigest(Utils::Fnv1a(text.data(), text.size())) + ext;
+        std::string path = outputDir + "/" + file;
+        BufferedWriter out(path, std::ios::out, tally);
+        if (compress) Compression::AttachSiblings(out, path, tally);
+        out.Put(text);
+        if (!out.Close()) throw std::runtime_error("cannot write " + path);
+        return file;
+    }
+
+    // Constants the app script starts from
+    static void WritePageData(BufferedWriter& out, const ExportSnapshot& snap, const std::vector<ShardFile>& shards) {
+        out << R"JS(        // Shard script per view, loaded on first use
+        const SHARDS = {)JS";
+        for (size_t i = 0; i < shards.size(); ++i) {
+            if (i) out.Put(',');
+            out.JsonString(shards[i].view).Put(':').JsonString(shards[i].file);
+        }
+        out << R"JS(};
+        const ecosystem = )JS";
+        snap.WriteEcosystem(out);
+        out << R"JS(;
+        // Organization table rows, best score first: [name, score, registry models, % of all models]
+        const ORG_STATS = [)JS";
+        for (size_t k = 0; k < snap.org_order.size(); ++k) {
+            size_t i = snap.org_order[k];
+            // Same operations as the page used to run, so the printed share is unchanged
+            double share = (static_cast<double>(snap.org_models[i]) / static_cast<double>(snap.registry.size())) * 100.0;
+            if (k) out.Put(',');
+            out.Put('[').JsonString(snap.ecosystem[i].first).Put(',').JsonNumber(snap.ecosystem[i].second)
+                .Put(',').Integer(static_cast<long long>(snap.org_models[i])).Put(',').JsonNumber(share).Put(']');
+        }
+        out << "];\n";
+    }
+
+    // CrossBench.loadShard(view,{"rows":N,"sorts":{...},"name":[...],"orgs":[...],"types":[...],"columns":"..."})
+    // `columns` is base64 of little-endian typed arrays, back to back, N values each:
+    //   Float64  score (the view's rank field), price, confidence, speed, coding, creative
+    //   Int32    days_ago
+    //   Uint32   org, type: codes into the `orgs` and `types` dictionaries
+    // then, per key of `sorts`, that many Uint32 row numbers in display order.
+    // Values are those of the JSON export, so the page prints the same text.
+    static void WriteViewShard(BufferedWriter& out, const ExportSnapshot& snap, size_t v, const std::vector<std::string>& pages,
+                               std::string& columns) {
+        const ExportSnapshot::ViewShard& shard = snap.shards[v];
+        const RankField field = Views::ALL[v].field;
+        auto pct = [](double x) { return std::clamp(x, 0.0, 100.0); };
+        auto put = [&](auto x) { columns.append(reinterpret_cast<const char*>(&x), sizeof x); };
+        auto column = [&](auto get) {
+            for (size_t idx : shard.rows) put(get(snap.registry[idx]));
+        };
+
+        columns.clear();
+        column([&](const ModelEntity& m) { return pct(RankValue(m.ranks, field)); });
+        column([](const ModelEntity& m) { return m.metrics.price_input_1m; });
+        column([](const ModelEntity& m) { return m.confidence_score; });
+        column([](const ModelEntity& m) { return m.metrics.tokens_per_sec; });
+        column([&](const ModelEntity& m) { return pct(m.metrics.coding_score * 100.0); });
+        column([&](const ModelEntity& m) { return pct(m.metrics.creative_score * 100.0); });
+        column([](const ModelEntity& m) { return static_cast<int32_t>(m.metrics.last_updated_days_ago); });
+
+        // Dictionaries in first-use order
+        struct Dictionary {
+            std::vector<std::string_view> values;
+            std::unordered_map<std::string_view, uint32_t> codes;
+            uint32_t Code(std::string_view s) {
+                auto [it, added] = codes.try_emplace(s, static_cast<uint32_t>(values.size()));
+                if (added) values.push_back(s);
+                return it->second;
+            }
+        } orgs, types;
+        column([&](const ModelEntity& m) { return orgs.Code(m.organization); });
+        column([&](const ModelEntity& m) { return types.Code(m.PrimaryType()); });
+        for (const auto& order : shard.order) {
+            for (uint32_t r : order) put(r);
+        }
+
+        out.Put("CrossBench.loadShard(").JsonString(Views::ALL[v].key).Put(",{\"rows\":").Integer(static_cast<long long>(shard.rows.size()));
+        out.Put(",\"sorts\":{");
+        for (size_t k = 0; k < ExportSnapshot::SORT_COUNT; ++k) {
+            if (k) out.Put(',');
+            out.JsonString(ExportSnapshot::SORT_KEYS[k]).Put(':').Integer(static_cast<long long>(shard.order[k].size()));
+        }
+        out.Put("},\"name\":[");
+        for (size_t r = 0; r < shard.rows.size(); ++r) {
+            if (r) out.Put(',');
+            out.JsonString(snap.registry[shard.rows[r]].name);
+        }
+        if (!pages.empty()) {
+            out.Put("],\"page\":[");
+            for (size_t r = 0; r < shard.rows.size(); ++r) {
+                if (r) out.Put(',');
+                out.JsonString(pages[shard.rows[r]]);
+            }
+        }
+        for (auto [key, dict] : {std::pair{"orgs", &orgs}, std::pair{"types", &types}}) {
+            out.Put("],\"").Put(key).Put("\":[");
+            for (size_t i = 0; i < dict->values.size(); ++i) {
+                if (i) out.Put(',');
+                out.JsonString(dict->values[i]);
+            }
+        }
+        out.Put("],\"columns\":\"").Base64(columns).Put("\"});\n");
+    }
+
+    // A table row as bindRow() in the page script leaves it for the Overall
+    // view; without a model, the empty #rowTemplate row it clones. The name
+    // links to `page`, the model's detail page, when there is one.
+    static void WriteRow(BufferedWriter& out, const ModelEntity* m = nullptr, size_t rank = 0, const std::string* page = nullptr) {
+        const bool isNew = m && m->metrics.last_updated_days_ago <= 30;
+        out << R"HTML(        <tr class="hover:bg-white/[0.02] transition-colors border-b border-white/[0.03] last:border-0 group">
+            <td class="p-4 text-center font-mono font-bold text-slate-600 group-hover:text-blue-500" data-f="rank">)HTML";
+        if (m) out.Put('#').Integer(static_cast<long long>(rank));
+        out << R"HTML(</td>
+            <td class="p-4">
+                <div class="flex items-center"><a class="model-link font-bold text-slate-100" data-f="name")HTML";
+        if (page) out.Put(" href=\"").Html(*page).Put('"');
+        out.Put('>');
+        if (m) out.Html(m->name);
+        out << R"HTML(</a><span class="ml-2 px-1.5 py-0.5 rounded cursor-help bg-green-500/10 text-green-400 text-[9px] font-bold border border-green-500/20 group relative" data-f="badge")HTML";
+        if (m && !isNew) out << R"HTML( style="display: none;")HTML";
+        out << R"HTML(>NEW<div class="tooltip absolute bottom-full left-1/2 -translate-x-1/2 mb-2 w-max px-3 py-1.5 bg-slate-900 border border-slate-700 rounded shadow-xl text-xs z-50 text-slate-300 font-normal normal-case" data-f="badgeTip">)HTML";
+        if (isNew) out << "Released " << m->metrics.last_updated_days_ago << " days ago";
+        out << R"HTML(</div></span></div>
+                <div class="text-xs font-medium text-slate-500 mt-1" data-f="org">)HTML";
+        if (m) out.Html(m->organization);
+        out << R"HTML(</div>
+            </td>
+            <td class="p-4 text-center" data-f="typeCell")HTML";
+        if (m) out << R"HTML( style="display: table-cell;")HTML";
+        out << R"HTML(><span class="px-2 py-0.5 rounded bg-slate-800 text-slate-500 text-[10px] uppercase font-bold tracking-wider" data-f="type">)HTML";
+        if (m) {
+            std::string_view type = m->PrimaryType();
+            if (type.empty()) type = "Text";
+            if (type == "Multimodal") out << "MULTI";
+            else for (char c : type.substr(0, 3)) out.Put(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+        }
+        out << R"HTML(</span></td>
+            <td class="p-4 text-right">
+                <div class="font-mono text-lg font-bold text-blue-400" data-f="score">)HTML";
+        if (m) out.JsFixed(std::clamp(m->ranks.overall, 0.0, 100.0), 1);
+        out << R"HTML(</div>
+                <div class="text-[9px] text-slate-600 font-bold uppercase tracking-wider" data-f="label">)HTML";
+        if (m) out << "Index Score";
+        out << R"HTML(</div>
+            </td>
+            <td class="p-4 text-right font-mono text-xs text-slate-400">
+                <div class="text-slate-300" data-f="metric">)HTML";
+        if (m) {
+            if (m->metrics.price_input_1m > 0) out.Put('$').JsFixed(m->metrics.price_input_1m, 2);
+            else out << "Free";
+        }
+        out << R"HTML(</div><div class="text-[9px] text-slate-600" data-f="metricSub">)HTML";
+        if (m) out << "per 1M";
+        out << R"HTML(</div>
+            </td>
+            <td class="p-4">
+                <div class="flex flex-col gap-1.5 w-full">
+                    <div class="flex justify-between text-[9px] font-bold tracking-wider text-slate-500">
+                        <span data-f="conf">)HTML";
+        if (m) out.JsFixed(m->confidence_score, 0).Put('%');
+        out << R"HTML(</span>
+                    </div>
+                    <div class="conf-bar-bg">
+                        <div class="conf-bar-fill)HTML";
+        if (m) out << (m->confidence_score > 80 ? " bg-emerald-500" : m->confidence_score > 50 ? " bg-amber-500" : " bg-rose-500");
+        out << R"HTML( shadow-[0_0_8px_rgba(0,0,0,0.5)]" data-f="bar")HTML";
+        if (m) out.Put(" style=\"width: ").Shortest(m->confidence_score).Put("%;\"");
+        out << R"HTML(></div>
+                    </div>
+                </div>
+            </td>
+        </tr>
+)HTML";
+    }
+
+    static const std::string& RowTemplate() {
+        static const std::string row = [] {
+            std::string text;
+            BufferedWriter out(&text);
+            WriteRow(out);
+            return text;
+        }();
+        return row;
+    }
+
+    static constexpr std::string_view PAGE_HEAD = R"HTML(<!DOCTYPE html>
 <html lang="en" class="dark">
 <head>
     <meta charset="UTF-8">
     <title>CrossBench - AI Model Leaderboard Aggregator</title>
-    <script src="https://cdn.tailwindcss.com"></script>
-    <script src="https://cdn.jsdelivr.net/npm/chart.js"></script>
-    <link href="https://fonts.googleapis.com/css2?family=Outfit:wght@300;400;600;800&family=JetBrains+Mono:wght@400;700&display=swap" rel="stylesheet">
-    <style>
-        body { background: #020617; color: #f8fafc; font-family: 'Outfit', sans-serif; }
-        .glass { background: rgba(15, 23, 42, 0.6); backdrop-filter: blur(12px); border: 1px solid rgba(255,255,255,0.05); }
-        .glass-header { background: rgba(2, 6, 23, 0.9); backdrop-filter: blur(20px); border-bottom: 1px solid rgba(255,255,255,0.05); }
+)HTML";
+
+    // Page-specific rules, after the utilities
+    static constexpr std::string_view PAGE_STYLE = R"HTML(        .glass-header { background: rgba(2, 6, 23, 0.9); backdrop-filter: blur(20px); border-bottom: 1px solid rgba(255,255,255,0.05); }
         .tab-btn { padding: 0.525rem 1.05rem; border-radius: 8px; font-size: 0.84rem; font-weight: 700; transition: all 0.2s; border: 1px solid transparent; }
         .tab-active { background: #3b82f6; color: white; border-color: #60a5fa; box-shadow: 0 0 15px rgba(59, 130, 246, 0.4); font-weight: 800; }
         .tab-inactive { color: #94a3b8; background: rgba(30, 41, 59, 0.4); }
         .tab-inactive:hover { background: rgba(51, 65, 85, 0.8); color: #cbd5e1; }
-        .conf-bar-bg { background: rgba(51, 65, 85, 0.3); border-radius: 99px; height: 8px; width: 100%; overflow: hidden; }
-        .conf-bar-fill { height: 100%; border-radius: 99px; }
         .tooltip { visibility: hidden; opacity: 0; transition: opacity 0.2s; position: absolute; z-index: 100; }
         .group:hover .tooltip { visibility: visible; opacity: 1; }
         #sortSelect option { background: #1e293b; color: #f8fafc; padding: 0.5rem; }
         #sortSelect option:hover { background: #334155; }
-    </style>
-</head>
+        .search-hit { background: rgba(59, 130, 246, 0.12); }
+        .model-link { text-decoration: none; }
+        .model-link[href]:hover { color: #60a5fa; text-decoration: underline; }
+        .chart-tip { display: none; position: fixed; z-index: 100; pointer-events: none; max-width: 320px; padding: 12px; border-radius: 6px; background: rgba(15, 23, 42, 0.95); border: 1px solid rgba(255,255,255,0.1); color: #cbd5e1; font-size: 12px; }
+        .chart-tip b { display: block; margin-bottom: 4px; color: #f8fafc; }
+)HTML";
+
+    static constexpr std::string_view PAGE_BODY = R"HTML(</head>
 <body class="min-h-screen flex flex-col">
     <!-- Header / Branding (V8.5 Layout) -->
     <header class="glass-header sticky top-0 z-50">
         <div class="max-w-7xl mx-auto px-6 py-5 flex flex-col gap-5">
-            <!-- Row 1: Identity -->
-            <div class="flex flex-col gap-2">
-                <div class="flex items-center gap-4">
-                    <div class="h-12 w-12 bg-gradient-to-br from-blue-600 to-indigo-700 rounded-xl flex items-center justify-center text-white font-extrabold text-2xl shadow-lg shadow-blue-500/30">CB</div>
-                    <div>
-                        <h1 class="font-extrabold tracking-tight text-white drop-shadow-md" style="font-size: 1.969rem;">CrossBench</h1>
-                        <div class="uppercase tracking-[0.2em] text-blue-400 font-bold" style="font-size: 12.1px;">AI Model Leaderboard Aggregator</div>
+            <!-- Row 1: Identity and search -->
+            <div class="flex flex-col md:flex-row justify-between gap-4">
+                <div class="flex flex-col gap-2">
+                    <div class="flex items-center gap-4">
+                        <div class="h-12 w-12 bg-gradient-to-br from-blue-600 to-indigo-700 rounded-xl flex items-center justify-center text-white font-extrabold text-2xl shadow-lg shadow-blue-500/30">CB</div>
+                        <div>
+                            <h1 class="font-extrabold tracking-tight text-white drop-shadow-md" style="font-size: 1.969rem;">CrossBench</h1>
+                            <div class="uppercase tracking-[0.2em] text-blue-400 font-bold" style="font-size: 12.1px;">AI Model Leaderboard Aggregator</div>
+                        </div>
                     </div>
+                    <p class="text-slate-400 leading-relaxed" style="font-size: 0.9625rem;">A Bias-Adjusted Aggregation of Multiple AI Leaderboards<br/>to Help You Compare Models Faster and Make Informed Decisions</p>
+                </div>
+                <div class="relative w-full md:w-80">
+                    <input id="searchBox" type="search" placeholder="Search models or organizations" autocomplete="off" spellcheck="false" class="w-full bg-slate-900/50 border border-white/10 rounded-lg px-3 py-2 text-sm text-white focus:outline-none">
+                    <div id="searchResults" class="hidden absolute right-0 mt-1 w-full max-h-96 overflow-y-auto bg-slate-900 border border-slate-700 rounded-lg shadow-xl z-50"></div>
                 </div>
-                <p class="text-slate-400 leading-relaxed" style="font-size: 0.9625rem;">A Bias-Adjusted Aggregation of Multiple AI Leaderboards<br/>to Help You Compare Models Faster and Make Informed Decisions</p>
             </div>
             
             <!-- Row 2: Navigation (Wrapped, No Scroll) -->
@@ -700,7 +3813,7 @@ public:
 
     <main class="flex-1 w-full max-w-7xl mx-auto p-6">
         <!-- Controls -->
-        <div class="flex flex-col md:flex-row justify-between items-end mb-6 gap-4 animate-fade-in" id="controlsBar">
+        <div class="flex flex-col md:flex-row justify-between items-end mb-6 gap-4" id="controlsBar">
             <div>
                  <h2 class="text-2xl font-bold text-white mb-1" id="viewTitle">Overall Ranking</h2>
                  <p class="text-slate-400 text-sm" id="viewDesc">Global performance synthesis across all metrics.</p>
@@ -748,7 +3861,11 @@ public:
                         </th>
                     </tr>
                 </thead>
-                <tbody id="tableBody" class="divide-y divide-white/5 text-sm"></tbody>
+                <tbody id="tableBody" class="divide-y divide-white/5 text-sm">
+)HTML";
+
+    // Render() streams the server-rendered rows between PAGE_BODY and this
+    static constexpr std::string_view PAGE_BODY_END = R"HTML(                </tbody>
             </table>
         </div>
 
@@ -790,26 +3907,85 @@ public:
             </div>
         </div>
     </main>
-    <script>
-        const rawData = )HTML" << jsonData << R"HTML(;
-        let models = rawData.models;
-        const ecosystem = rawData.ecosystem;
-        
-        // Config: Set global chart defaults for dark mode visibility
-        Chart.defaults.color = '#ffffff';
-        Chart.defaults.borderColor = 'rgba(255,255,255,0.1)';
+    <!-- Row templates, cloned by the script and filled through textContent -->
+    <template id="rowTemplate">
+)HTML";
 
+    // Follows the #rowTemplate row, which WriteRow() prints
+    static constexpr std::string_view PAGE_TEMPLATES = R"HTML(    </template>
+    <template id="searchRowTemplate">
+        <button type="button" class="w-full text-left px-3 py-2 flex justify-between items-center gap-3 border-b border-white/5 last:border-0 hover:bg-slate-800 cursor-pointer">
+            <span><span class="block text-sm font-semibold text-slate-100" data-f="name"></span><span class="block text-xs text-slate-500" data-f="org"></span></span>
+            <span class="text-xs font-mono text-blue-400 whitespace-nowrap" data-f="where"></span>
+        </button>
+    </template>
+    <template id="orgRowTemplate">
+        <tr class="hover:bg-white/[0.02]">
+            <td class="p-3 font-semibold text-slate-200"></td>
+            <td class="p-3 text-center font-mono text-slate-300"></td>
+            <td class="p-3 text-right font-mono text-blue-400 font-bold"></td>
+            <td class="p-3 text-right font-mono text-emerald-400"></td>
+        </tr>
+    </template>
+)HTML";
+
+    static constexpr std::string_view PAGE_SCRIPT = R"HTML(        const shardCache = {};
+        window.CrossBench = {
+            loadShard(view, data) {
+                shardCache[view] = view === 'search' ? data : decodeShard(data);
+                if (view === currentView) renderCurrentView();
+                if (view === 'search') renderSearch();
+            }
+        };
+
+        // View shards carry their numbers as one base64 block of little-endian
+        // typed arrays, in the order DashboardView::WriteViewShard packs them.
+        // Rows are read straight from the columns; no per-model objects exist.
+        function decodeShard(data) {
+            const text = atob(data.columns);
+            const bytes = new Uint8Array(text.length);
+            for (let i = 0; i < text.length; i++) bytes[i] = text.charCodeAt(i);
+            let at = 0;
+            const take = (Type, n) => {
+                const column = new Type(bytes.buffer, at, n);
+                at += n * Type.BYTES_PER_ELEMENT;
+                return column;
+            };
+            const n = data.rows;
+            const shard = {
+                name: data.name, page: data.page, orgs: data.orgs, types: data.types,
+                score: take(Float64Array, n), price: take(Float64Array, n), confidence: take(Float64Array, n),
+                speed: take(Float64Array, n), coding: take(Float64Array, n), creative: take(Float64Array, n),
+                daysAgo: take(Int32Array, n), org: take(Uint32Array, n), type: take(Uint32Array, n),
+                order: {}
+            };
+            for (const [key, count] of Object.entries(data.sorts)) shard.order[key] = take(Uint32Array, count);
+            return shard;
+        }
+
+        function requestShard(view) {
+            if (shardCache[view] || !SHARDS[view] || document.getElementById(`shard-${view}`)) return;
+            const script = document.createElement('script');
+            script.id = `shard-${view}`;
+            script.src = SHARDS[view];
+            script.onerror = () => {
+                script.remove();
+                if (view === currentView) showMessage(`Could not load ${SHARDS[view]}.`, 'text-rose-400');
+            };
+            document.head.appendChild(script);
+        }
+        
         const views = {
-            'overall':    { title: 'Overall',    desc: 'Bias-adjusted performance synthesis', rankKey: 'overall', label: 'Index Score', tooltip_score: 'Composite score: Weighted average of reasoning, coding, creative, confidence, and price metrics (0-100 scale)', tooltip_metric: 'Cost: Price per 1M input tokens' },
-            'value':      { title: 'Best Value', desc: 'Performance per USD unit', rankKey: 'value', label: 'Value Ratio', tooltip_score: 'Value Score: Performance points divided by price - higher is better bang for buck', tooltip_metric: 'Cost: Input price per 1M tokens' },
-            'coding':     { title: 'Coding',     desc: 'Software development capabilities', rankKey: 'coding', label: 'Code Score', tooltip_score: 'Coding Score: Specialized programming benchmark weighted with reasoning & context window (0-100)', tooltip_metric: 'Coding Capability: Benchmark performance' },
-            'image':      { title: 'Image Gen',  desc: 'Visual generation quality', rankKey: 'image', label: 'Creative Score', tooltip_score: 'Image Score: Visual quality, prompt adherence, and artistic coherence (0-100)', tooltip_metric: 'Creative Rating: Generation quality score' },
-            'video':      { title: 'Video Gen',  desc: 'Temporal visual synthesis', rankKey: 'video', label: 'Motion Score', tooltip_score: 'Video Score: Temporal consistency, motion physics, and visual fidelity (0-100)', tooltip_metric: 'Creative Rating: Video generation quality' },
-            'speed':      { title: 'Speed',      desc: 'Token generation throughput', rankKey: 'speed', label: 'Tokens/Sec', tooltip_score: 'Speed Score: Normalized throughput performance (0-100 scale)', tooltip_metric: 'Throughput: Raw tokens generated per second' },
-            'conf':       { title: 'Confidence', desc: 'Data verification level', rankKey: 'confidence', label: 'Reliability', tooltip_score: 'Confidence Level: Data verification percentage based on multi-benchmark validation (0-100%)', tooltip_metric: 'Cost: Price per 1M tokens' },
-            'enterprise': { title: 'Enterprise', desc: 'SLA & organizational maturity', rankKey: 'enterprise', label: 'Readiness', tooltip_score: 'Enterprise Score: SLA guarantees, organizational maturity, and reliability (0-100)', tooltip_metric: 'Cost: Price per 1M tokens' },
-            'opensource': { title: 'Open Source',desc: 'Publicly available weights', rankKey: 'overall', label: 'Index Score', tooltip_score: 'Overall Score: Composite performance for open-source models only (0-100)', tooltip_metric: 'Cost: Price (usually free or hosting cost)' },
-            'ecosystem':  { title: 'Ecosystem',  desc: 'Market share analysis', rankKey: 'overall', label: 'Share', tooltip_score: '', tooltip_metric: '' }
+            'overall':    { title: 'Overall',    desc: 'Bias-adjusted performance synthesis', label: 'Index Score', tooltip_score: 'Composite score: Weighted average of reasoning, coding, creative, confidence, and price metrics (0-100 scale)', tooltip_metric: 'Cost: Price per 1M input tokens' },
+            'value':      { title: 'Best Value', desc: 'Performance per USD unit', label: 'Value Ratio', tooltip_score: 'Value Score: Performance points divided by price - higher is better bang for buck', tooltip_metric: 'Cost: Input price per 1M tokens' },
+            'coding':     { title: 'Coding',     desc: 'Software development capabilities', label: 'Code Score', tooltip_score: 'Coding Score: Specialized programming benchmark weighted with reasoning & context window (0-100)', tooltip_metric: 'Coding Capability: Benchmark performance' },
+            'image':      { title: 'Image Gen',  desc: 'Visual generation quality', label: 'Creative Score', tooltip_score: 'Image Score: Visual quality, prompt adherence, and artistic coherence (0-100)', tooltip_metric: 'Creative Rating: Generation quality score' },
+            'video':      { title: 'Video Gen',  desc: 'Temporal visual synthesis', label: 'Motion Score', tooltip_score: 'Video Score: Temporal consistency, motion physics, and visual fidelity (0-100)', tooltip_metric: 'Creative Rating: Video generation quality' },
+            'speed':      { title: 'Speed',      desc: 'Token generation throughput', label: 'Tokens/Sec', tooltip_score: 'Speed Score: Normalized throughput performance (0-100 scale)', tooltip_metric: 'Throughput: Raw tokens generated per second' },
+            'conf':       { title: 'Confidence', desc: 'Data verification level', label: 'Reliability', tooltip_score: 'Confidence Level: Data verification percentage based on multi-benchmark validation (0-100%)', tooltip_metric: 'Cost: Price per 1M tokens' },
+            'enterprise': { title: 'Enterprise', desc: 'SLA & organizational maturity', label: 'Readiness', tooltip_score: 'Enterprise Score: SLA guarantees, organizational maturity, and reliability (0-100)', tooltip_metric: 'Cost: Price per 1M tokens' },
+            'opensource': { title: 'Open Source',desc: 'Publicly available weights', label: 'Index Score', tooltip_score: 'Overall Score: Composite performance for open-source models only (0-100)', tooltip_metric: 'Cost: Price (usually free or hosting cost)' },
+            'ecosystem':  { title: 'Ecosystem',  desc: 'Market share analysis', label: 'Share', tooltip_score: '', tooltip_metric: '' }
         };
         let currentView = 'overall';
         
@@ -836,156 +4012,41 @@ public:
                 tabContainer.appendChild(btn);
             });
             
-            // Initialize Ecosystem Charts
+            renderCurrentView();
+        }
+
+        // Charts and the organization table are built the first time the
+        // Ecosystem tab opens, once their containers are visible
+        let ecosystemReady = false;
+        function initEcosystem() {
+            if (ecosystemReady) return;
+            ecosystemReady = true;
             const ecosystemLabels = Object.keys(ecosystem);
             const ecosystemValues = Object.values(ecosystem);
             
             // Chart 1: Market Share (Doughnut)
-            new Chart(document.getElementById('ecosystemChart'), { 
-                type: 'doughnut', 
-                data: { 
-                    labels: ecosystemLabels, 
-                    datasets: [{ 
-                        data: ecosystemValues, 
-                        backgroundColor: [
-                            '#3b82f6', '#6366f1', '#8b5cf6', '#d946ef', 
-                            '#ec4899', '#f43f5e', '#f59e0b', '#10b981', 
-                            '#06b6d4', '#0ea5e9', '#6366f1', '#8b5cf6',
-                            '#a855f7', '#d946ef', '#ec4899', '#f43f5e'
-                        ], 
-                        borderWidth: 2,
-                        borderColor: '#020617',
-                        hoverOffset: 15,
-                        hoverBorderWidth: 3
-                    }] 
-                }, 
-                options: { 
-                    responsive: true,
-                    maintainAspectRatio: false,
-                    cutout: '65%', 
-                    plugins: { 
-                        legend: { 
-                            position: 'right',
-                            labels: { 
-                                color: '#ffffff',
-                                font: { family: 'Outfit', size: 13, weight: '700' }, 
-                                usePointStyle: true, 
-                                padding: 15,
-                                boxPadding: 8,
-                                generateLabels: function(chart) {
-                                    const data = chart.data;
-                                    if (data.labels.length && data.datasets.length) {
-                                        return data.labels.map((label, i) => {
-                                            const value = data.datasets[0].data[i];
-                                            const total = data.datasets[0].data.reduce((a, b) => a + b, 0);
-                                            const percentage = ((value / total) * 100).toFixed(1);
-                                            return {
-                                                text: `${label}: ${percentage}%`,
-                                                fillStyle: data.datasets[0].backgroundColor[i],
-                                                strokeStyle: '#ffffff',
-                                                lineWidth: 1,
-                                                hidden: false,
-                                                index: i
-                                            };
-                                        });
-                                    }
-                                    return [];
-                                }
-                            } 
-                        },
-                        tooltip: {
-                            backgroundColor: 'rgba(15, 23, 42, 0.95)',
-                            titleColor: '#f8fafc',
-                            bodyColor: '#cbd5e1',
-                            borderColor: 'rgba(255,255,255,0.1)',
-                            borderWidth: 1,
-                            padding: 12,
-                            displayColors: true,
-                            callbacks: {
-                                label: function(context) {
-                                    const label = context.label || '';
-                                    const value = context.parsed;
-                                    const total = context.dataset.data.reduce((a, b) => a + b, 0);
-                                    const percentage = ((value / total) * 100).toFixed(1);
-                                    return `${label}: ${percentage}% (Avg Score: ${value.toFixed(2)})`;
-                                }
-                            }
-                        }
-                    } 
-                } 
-            });
-            
+            MiniChart.doughnut(document.getElementById('ecosystemChart'), ecosystemLabels, ecosystemValues, [
+                '#3b82f6', '#6366f1', '#8b5cf6', '#d946ef',
+                '#ec4899', '#f43f5e', '#f59e0b', '#10b981',
+                '#06b6d4', '#0ea5e9', '#6366f1', '#8b5cf6',
+                '#a855f7', '#d946ef', '#ec4899', '#f43f5e'
+            ]);
+
             // Chart 2: Performance Comparison (Bar)
-            new Chart(document.getElementById('performanceChart'), {
-                type: 'bar',
-                data: {
-                    labels: ecosystemLabels,
-                    datasets: [{
-                        label: 'Average Performance Score',
-                        data: ecosystemValues,
-                        backgroundColor: '#3b82f6',
-                        borderColor: '#60a5fa',
-                        borderWidth: 1,
-                        borderRadius: 6,
-                        hoverBackgroundColor: '#60a5fa'
-                    }]
-                },
-                options: {
-                    responsive: true,
-                    maintainAspectRatio: false,
-                    indexAxis: 'y',
-                    plugins: {
-                        legend: { display: false },
-                        tooltip: {
-                            backgroundColor: 'rgba(15, 23, 42, 0.95)',
-                            titleColor: '#f8fafc',
-                            bodyColor: '#cbd5e1',
-                            borderColor: 'rgba(255,255,255,0.1)',
-                            borderWidth: 1,
-                            padding: 12,
-                            callbacks: {
-                                label: function(context) {
-                                    return `Avg Score: ${context.parsed.x.toFixed(2)}`;
-                                }
-                            }
-                        }
-                    },
-                    scales: {
-                        x: {
-                            beginAtZero: true,
-                            max: 15,
-                            grid: { color: 'rgba(255,255,255,0.05)' },
-                            ticks: { color: '#94a3b8', font: { size: 11 } }
-                        },
-                        y: {
-                            grid: { display: false },
-                            ticks: { color: '#cbd5e1', font: { size: 11, weight: '600' } }
-                        }
-                    }
-                }
-            });
-            
-            // Populate Organization Stats Table
-            const orgStatsBody = document.getElementById('orgStatsBody');
-            const orgData = Object.entries(ecosystem).map(([org, avgScore]) => {
-                const modelCount = models.filter(m => m.org === org).length;
-                return { org, avgScore, modelCount };
-            }).sort((a, b) => b.avgScore - a.avgScore);
-            
-            const totalModels = models.length;
-            orgData.forEach(item => {
-                const marketShare = ((item.modelCount / totalModels) * 100).toFixed(1);
-                orgStatsBody.innerHTML += `
-                    <tr class="hover:bg-white/[0.02]">
-                        <td class="p-3 font-semibold text-slate-200">${item.org}</td>
-                        <td class="p-3 text-center font-mono text-slate-300">${item.modelCount}</td>
-                        <td class="p-3 text-right font-mono text-blue-400 font-bold">${item.avgScore.toFixed(2)}</td>
-                        <td class="p-3 text-right font-mono text-emerald-400">${marketShare}%</td>
-                    </tr>
-                `;
+            MiniChart.bar(document.getElementById('performanceChart'), ecosystemLabels, ecosystemValues, 15);
+
+            // Organization Stats Table, ordered and counted by the exporter
+            const orgTemplate = document.getElementById('orgRowTemplate').content.firstElementChild;
+            const orgRows = document.createDocumentFragment();
+            ORG_STATS.forEach(([org, avgScore, modelCount, share]) => {
+                const tr = orgTemplate.cloneNode(true);
+                tr.cells[0].textContent = org;
+                tr.cells[1].textContent = modelCount;
+                tr.cells[2].textContent = avgScore.toFixed(2);
+                tr.cells[3].textContent = `${share.toFixed(1)}%`;
+                orgRows.appendChild(tr);
             });
-            
-            renderCurrentView();
+            document.getElementById('orgStatsBody').replaceChildren(orgRows);
         }
 
         function switchView(viewKey) {
@@ -1002,123 +4063,801 @@ public:
             document.getElementById('ecosystemContainer').classList.toggle('hidden', !isEco);
             document.getElementById('controlsBar').classList.toggle('hidden', isEco);
             
-            if(!isEco) {
+            if (isEco) {
+                initEcosystem();
+            } else {
                 renderCurrentView();
                 updateHeaderTooltips(viewKey);
             }
         }
 
-        function renderCurrentView(isSortOverride = false) {
-            const viewDef = views[currentView];
-            if(!viewDef) return;
+        // --- Virtualized table ---
+        // Only rows in or near the viewport exist. A pool of <tr> nodes cloned
+        // from #rowTemplate is re-bound in place on scroll, sort and tab
+        // changes; two spacer rows stand in for the rows above and below.
+        const OVERSCAN = 10;
+        const tableBody = document.getElementById('tableBody');
+        const rowPool = [];
+        let attachedRows = 0;
+        let rowHeight = 73;     // Re-measured from the first bound row
+        let displayShard = null;
+        let displayRows = [];   // Shard rows of the active view, in display order
+        let showTypeColumn = true;
+        let boundFirst = -1, boundCount = -1;
+
+        function spacerRow() {
+            const tr = document.createElement('tr');
+            const td = document.createElement('td');
+            td.colSpan = 6;
+            td.style.padding = '0';
+            tr.appendChild(td);
+            return tr;
+        }
+        const messageRow = spacerRow();
+        const topSpacer = spacerRow();
+        const bottomSpacer = spacerRow();
+        messageRow.style.display = 'none';
+        // The exporter renders the first Overall rows into the page; they
+        // become the first pool rows and stay up until the shard re-binds them
+        let serverRows = tableBody.rows.length;
+        for (const tr of tableBody.rows) rowPool.push(indexFields(tr));
+        attachedRows = serverRows;
+        tableBody.prepend(messageRow, topSpacer);
+        tableBody.append(bottomSpacer);
+
+        function showMessage(text, color = 'text-slate-500') {
+            serverRows = 0;
+            displayRows = [];
+            renderWindow();
+            messageRow.cells[0].className = `p-8 text-center ${color}`;
+            messageRow.cells[0].textContent = text;
+            messageRow.style.display = '';
+        }
+
+        function indexFields(tr) {
+            tr.fields = {};
+            tr.querySelectorAll('[data-f]').forEach(el => { tr.fields[el.dataset.f] = el; });
+            return tr;
+        }
+
+        function newRow() {
+            return indexFields(document.getElementById('rowTemplate').content.firstElementChild.cloneNode(true));
+        }
+
+        // Main text and caption of the METRICS cell for the current view
+        function metricCell(s, i) {
+            if (currentView === 'speed') return [`${s.speed[i].toFixed(0)} tok/s`, 'throughput'];
+            if (currentView === 'video' || currentView === 'image') return [`Creative: ${(s.creative[i] * 100).toFixed(0)}`, 'generation'];
+            if (currentView === 'coding') return [`Code: ${(s.coding[i] * 100).toFixed(0)}`, 'capability'];
+            return [s.price[i] > 0 ? '$' + s.price[i].toFixed(2) : 'Free', 'per 1M'];
+        }
+
+        // Row `i` of shard `s`
+        function bindRow(tr, s, i, rank) {
+            const f = tr.fields;
+            const viewDef = views[currentView];
+            const name = s.name[i], org = s.orgs[s.org[i]];
+            f.rank.textContent = `#${rank}`;
+            f.name.textContent = name;
+            if (s.page) f.name.href = s.page[i];
+            else f.name.removeAttribute('href');
+            f.org.textContent = org;
+            // Interactive, hover-only tooltip for recency
+            const daysAgo = s.daysAgo[i];
+            const isNew = daysAgo <= 30;
+            f.badge.style.display = isNew ? '' : 'none';
+            if (isNew) f.badgeTip.textContent = `Released ${daysAgo} days ago`;
+
+            const primaryType = s.types[s.type[i]] || 'Text';
+            f.typeCell.style.display = showTypeColumn ? 'table-cell' : 'none';
+            f.type.textContent = primaryType === 'Multimodal' ? 'MULTI' : primaryType.substring(0, 3).toUpperCase();
+
+            // All scores normalized to 0-100 scale for consistency
+            f.score.textContent = s.score[i].toFixed(1);
+            f.label.textContent = viewDef.label;
+            [f.metric.textContent, f.metricSub.textContent] = metricCell(s, i);
+
+            const confidence = s.confidence[i];
+            let confColor = 'bg-rose-500';
+            if(confidence > 80) confColor = 'bg-emerald-500';
+            else if(confidence > 50) confColor = 'bg-amber-500';
+            f.conf.textContent = `${confidence.toFixed(0)}%`;
+            f.bar.className = `conf-bar-fill ${confColor} shadow-[0_0_8px_rgba(0,0,0,0.5)]`;
+            f.bar.style.width = `${confidence}%`;
+            tr.classList.toggle('search-hit', searchHit !== null && name === searchHit.name && org === searchHit.org);
+        }
+
+        // Attach and bind the rows that intersect the viewport (plus OVERSCAN)
+        function renderWindow(force = false) {
+            const n = displayRows.length;
+            const top = tableBody.getBoundingClientRect().top;
+            const first = Math.max(0, Math.min(n, Math.floor(-top / rowHeight) - OVERSCAN));
+            const last = Math.min(n, Math.max(first, Math.ceil((window.innerHeight - top) / rowHeight) + OVERSCAN));
+            const count = last - first;
+            if (!force && first === boundFirst && count === boundCount) return;
+            boundFirst = first;
+            boundCount = count;
+
+            while (rowPool.length < count) rowPool.push(newRow());
+            if (attachedRows < count) {
+                const fragment = document.createDocumentFragment();
+                for (let k = attachedRows; k < count; k++) fragment.appendChild(rowPool[k]);
+                tableBody.insertBefore(fragment, bottomSpacer);
+            }
+            for (let k = count; k < attachedRows; k++) rowPool[k].remove();
+            attachedRows = count;
+
+            for (let k = 0; k < count; k++) bindRow(rowPool[k], displayShard, displayRows[first + k], first + k + 1);
+            topSpacer.cells[0].style.height = `${first * rowHeight}px`;
+            bottomSpacer.cells[0].style.height = `${(n - last) * rowHeight}px`;
+
+            const measured = count ? rowPool[0].getBoundingClientRect().height : 0;
+            if (measured > 0 && Math.abs(measured - rowHeight) > 0.5) {
+                rowHeight = measured;
+                renderWindow(true);
+            }
+        }
+
+        let windowQueued = false;
+        function queueWindow() {
+            if (windowQueued) return;
+            windowQueued = true;
+            requestAnimationFrame(() => {
+                windowQueued = false;
+                if (displayRows.length) renderWindow();
+            });
+        }
+        window.addEventListener('scroll', queueWindow, { passive: true });
+        window.addEventListener('resize', queueWindow);
+
+        function renderCurrentView(isSortOverride = false) {
+            const viewDef = views[currentView];
+            if(!viewDef) return;
+
+            // Control Type column visibility: show only in Overall, Value, Enterprise, Open Source, Confidence
+            showTypeColumn = ['overall', 'value', 'enterprise', 'opensource', 'conf'].includes(currentView);
+            // header-modality is now th-type
+            const thType = document.getElementById('th-type');
+            if (thType) thType.style.display = showTypeColumn ? 'table-cell' : 'none';
+
+            const shard = shardCache[currentView];
+            const sortMode = document.getElementById('sortSelect').value;
+            if (!shard) {
+                // Server-rendered rows already show the Overall default order
+                if (!(serverRows && currentView === 'overall' && sortMode === 'default')) showMessage('Loading...');
+                requestShard(currentView);
+                return;
+            }
+            serverRows = 0;
+
+            // Shards arrive filtered, with every sort order precomputed in C++
+            // (the default one is the order of the CSV exports)
+            const rows = shard.order[sortMode];
+            if (rows.length === 0) {
+                showMessage('No models available in this category.');
+                return;
+            }
+            messageRow.style.display = 'none';
+            displayShard = shard;
+            displayRows = rows;
+            renderWindow(true);
+            revealSearchHit();
+        }
+
+        // --- Search ---
+        // Trigram index built by the exporter (shards/search.<hash>.js): ASCII
+        // case-folded names and organizations, postings as delta-coded entry
+        // numbers in ranking order. Mirrors SearchIndex::Find in the C++.
+        const SEARCH_LIMIT = 20;
+        const searchBox = document.getElementById('searchBox');
+        const searchResults = document.getElementById('searchResults');
+        let searchHit = null;   // Model picked from the results, highlighted in its view
+        let searchShown = [];
+
+        const foldCase = s => ' ' + s.replace(/[A-Z]+/g, c => c.toLowerCase());
+
+        function postings(index, gram) {
+            if (!Object.prototype.hasOwnProperty.call(index.grams, gram)) return null;
+            let list = index.grams[gram];
+            if (!(list instanceof Uint32Array)) {
+                const deltas = list;
+                list = new Uint32Array(deltas.length);
+                for (let i = 0, e = 0; i < deltas.length; i++) list[i] = e += deltas[i];
+                index.grams[gram] = list;
+            }
+            return list;
+        }
+
+        function contains(list, e) {
+            let lo = 0, hi = list.length;
+            while (lo < hi) {
+                const mid = (lo + hi) >> 1;
+                if (list[mid] < e) lo = mid + 1; else hi = mid;
+            }
+            return lo < list.length && list[lo] === e;
+        }
+
+        // Entries whose name or organization contains `query`, best ranked
+        // first. Two characters match word starts; one matches nothing.
+        function findModels(index, query) {
+            let q = Array.from(foldCase(query.replace(/^ +| +$/g, '')).slice(1));
+            if (q.length < 2) return [];
+            if (q.length === 2) q.unshift(' ');
+            const lists = [];
+            for (let i = 0; i + 3 <= q.length; i++) {
+                const list = postings(index, q.slice(i, i + 3).join(''));
+                if (!list) return [];
+                lists.push(list);
+            }
+            lists.sort((a, b) => a.length - b.length);
+            const needle = q.join(''), hits = [];
+            for (const e of lists[0]) {
+                if (!lists.every(l => l === lists[0] || contains(l, e))) continue;
+                // Consecutive grams can straddle a gap the query does not have
+                if (!foldCase(index.name[e]).includes(needle) && !foldCase(index.orgs[index.org[e]]).includes(needle)) continue;
+                hits.push(e);
+                if (hits.length === SEARCH_LIMIT) break;
+            }
+            return hits;
+        }
+
+        function renderSearch() {
+            const query = searchBox.value.trim();
+            searchResults.classList.toggle('hidden', query === '');
+            if (query === '') return;
+            const index = shardCache.search;
+            if (!index) {
+                requestShard('search');
+                searchResults.replaceChildren(searchNote('Loading search index...'));
+                return;
+            }
+            searchShown = findModels(index, query);
+            if (searchShown.length === 0) {
+                searchResults.replaceChildren(searchNote(Array.from(query).length < 2 ? 'Type at least two characters.' : 'No matching models.'));
+                return;
+            }
+            const template = document.getElementById('searchRowTemplate').content.firstElementChild;
+            const items = document.createDocumentFragment();
+            searchShown.forEach(e => {
+                const item = template.cloneNode(true);
+                const field = name => item.querySelector(`[data-f="${name}"]`);
+                field('name').textContent = index.name[e];
+                field('org').textContent = index.orgs[index.org[e]];
+                const view = index.view[e];
+                field('where').textContent = view < 0 ? 'not listed' : `${views[index.views[view]].title} #${index.row[e] + 1}`;
+                item.onclick = () => openSearchResult(e);
+                items.appendChild(item);
+            });
+            searchResults.replaceChildren(items);
+        }
+
+        function searchNote(text) {
+            const div = document.createElement('div');
+            div.className = 'px-3 py-2 text-xs text-slate-500';
+            div.textContent = text;
+            return div;
+        }
+
+        // Switch to the model's view in default order and scroll its row into view
+        function openSearchResult(e) {
+            const index = shardCache.search;
+            searchResults.classList.add('hidden');
+            searchHit = { name: index.name[e], org: index.orgs[index.org[e]], row: index.row[e], pending: true };
+            if (index.view[e] < 0) return;
+            document.getElementById('sortSelect').value = 'default';
+            switchView(index.views[index.view[e]]);
+        }
+
+        function revealSearchHit() {
+            if (!searchHit || !searchHit.pending || document.getElementById('sortSelect').value !== 'default') return;
+            searchHit.pending = false;
+            const header = document.querySelector('header').offsetHeight;
+            const top = tableBody.getBoundingClientRect().top + window.scrollY + searchHit.row * rowHeight;
+            window.scrollTo(0, Math.max(0, top - header - 16));
+        }
+
+        searchBox.addEventListener('focus', () => requestShard('search'));
+        searchBox.addEventListener('input', renderSearch);
+        searchBox.addEventListener('keydown', event => {
+            if (event.key === 'Enter' && searchShown.length && !searchResults.classList.contains('hidden')) openSearchResult(searchShown[0]);
+            if (event.key === 'Escape') searchResults.classList.add('hidden');
+        });
+        document.addEventListener('click', event => {
+            if (!searchResults.parentElement.contains(event.target)) searchResults.classList.add('hidden');
+        });
+
+        // Browsers only run service workers for pages served over http(s)
+        if ('serviceWorker' in navigator && location.protocol.startsWith('http')) {
+            navigator.serviceWorker.register('sw.js').catch(() => {});
+        }
+        
+        init();
+)HTML";
+
+    static constexpr std::string_view PAGE_END = R"HTML(</body>
+</html>
+)HTML";
+
+    // Follows the SHELL and SHARDS lists WriteWorker() prints. Hashed names
+    // never change contents, so a cached copy is always current; install
+    // fetches only the shell files the cache lacks.
+    static constexpr std::string_view WORKER_SCRIPT = R"JS(const CACHE = 'crossbench';
+const BASE = self.registration.scope;
+const HASHED = /^(assets|shards)\//;
+
+self.addEventListener('install', event => {
+    event.waitUntil(caches.open(CACHE)
+        .then(cache => Promise.all(SHELL.map(file => cache.match(file).then(hit => hit || cache.add(file)))))
+        .then(() => self.skipWaiting()));
+});
+
+self.addEventListener('activate', event => {
+    const live = new Set([...SHELL, ...SHARDS]);
+    event.waitUntil(caches.open(CACHE)
+        .then(cache => cache.keys().then(requests => Promise.all(requests.map(request => {
+            const file = request.url.slice(BASE.length);
+            return HASHED.test(file) && !live.has(file) ? cache.delete(request) : null;
+        }))))
+        .then(() => self.clients.claim()));
+});
+
+self.addEventListener('fetch', event => {
+    const request = event.request;
+    if (request.method !== 'GET' || !request.url.startsWith(BASE)) return;
+    const keep = response => {
+        if (response.ok) caches.open(CACHE).then(cache => cache.put(request, response));
+    };
+    if (HASHED.test(request.url.slice(BASE.length))) {
+        event.respondWith(caches.match(request).then(hit => hit || fetch(request).then(response => {
+            keep(response.clone());
+            return response;
+        })));
+    } else if (request.mode === 'navigate') {
+        // The page changes with every refresh: network first, the last copy offline
+        event.respondWith(fetch(request).then(response => {
+            keep(response.clone());
+            return response;
+        }).catch(() => caches.match(request).then(hit => hit || Response.error())));
+    }
+});
+)JS";
+};
+
+// --- Model Pages ---
+// Static detail page per model, output/models/<slug>.html, with every metric,
+// rank score, signal and the confidence reason. models/manifest.txt records
+// the content hash each page was rendered from; a page is rendered again only
+// when that hash changes, so a refresh costs in proportion to churn rather
+// than catalog size. Stale pages are rendered on parallel threads.
+class ModelPages {
+public:
+    static constexpr const char* DIR = "models";
+    // "compressed 0|1", then one "<hash> <file>" line per page
+    static constexpr const char* MANIFEST = "manifest.txt";
+
+    struct Result {
+        size_t rendered = 0;
+        size_t kept = 0;    // Hash unchanged, page not rendered
+        size_t removed = 0; // Pages of models no longer in the registry
+    };
+
+    static Result Write(const std::vector<ModelEntity>& registry, const std::string& outputDir, bool compress = false,
+                        PublishTally* tally = nullptr, unsigned threads = 0) {
+        std::string dir = outputDir + "/" + DIR;
+        Utils::EnsureDirectoryExists(dir);
+        std::unordered_map<std::string, uint64_t> previous = ReadManifest(dir, compress);
+        std::vector<std::string> files = FileNames(registry);
+
+        Result result;
+        std::vector<uint64_t> hashes(registry.size());
+        std::vector<size_t> stale;
+        for (size_t i = 0; i < registry.size(); ++i) {
+            hashes[i] = PageHash(registry[i]);
+            auto it = previous.find(files[i]);
+            if (it != previous.end() && it->second == hashes[i] && fs::exists(dir + "/" + files[i])) result.kept++;
+            else stale.push_back(i);
+            if (it != previous.end()) previous.erase(it);
+        }
+
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<size_t>(threads, stale.size()));
+        std::atomic<bool> failed{false};
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            size_t begin = stale.size() * t / threads;
+            size_t end = stale.size() * (t + 1) / threads;
+            pool.emplace_back([&, begin, end] {
+                for (size_t k = begin; k < end && !failed; ++k) {
+                    std::string path = dir + "/" + files[stale[k]];
+                    BufferedWriter out(path, std::ios::out, tally);
+                    if (compress) Compression::AttachSiblings(out, path, tally);
+                    Render(out, registry[stale[k]]);
+                    if (!out.Close()) failed = true;
+                }
+            });
+        }
+        for (auto& th : pool) th.join();
+        if (failed) throw std::runtime_error("cannot write model pages in " + dir);
+        result.rendered = stale.size();
+
+        // Written after the pages, so it never vouches for a page that is not on disk
+        std::string manifest = dir + "/" + MANIFEST;
+        BufferedWriter out(manifest, std::ios::out, tally);
+        out.Put("compressed ").Put(compress ? '1' : '0').Put('\n');
+        for (size_t i = 0; i < registry.size(); ++i) out.Put(Utils::HexDigest(hashes[i])).Put(' ').Put(files[i]).Put('\n');
+        if (!out.Close()) throw std::runtime_error("cannot write " + manifest);
+
+        // Whatever the old manifest still lists belonged to models that are gone
+        std::error_code ec;
+        for (const auto& entry : previous) {
+            for (const char* ext : {"", ".gz", ".zst"}) fs::remove(dir + "/" + entry.first + ext, ec);
+            result.removed++;
+        }
+        return result;
+    }
+
+    // Page file name per registry model: the name in lowercase ASCII letters,
+    // digits and dashes, with a hash suffix where two names would collide
+    static std::vector<std::string> FileNames(const std::vector<ModelEntity>& registry) {
+        std::vector<std::string> files;
+        files.reserve(registry.size());
+        std::unordered_set<std::string> taken;
+        for (const auto& m : registry) {
+            std::string slug;
+            for (char c : m.name) {
+                if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) slug.push_back(c);
+                else if (c >= 'A' && c <= 'Z') slug.push_back(static_cast<char>(c - 'A' + 'a'));
+                else if (!slug.empty() && slug.back() != '-') slug.push_back('-');
+            }
+            while (!slug.empty() && slug.back() == '-') slug.pop_back();
+            if (slug.empty()) slug = "model";
+            if (!taken.insert(slug).second) {
+                slug += "-" + Utils::HexDigest(Utils::Fnv1a(m.name.data(), m.name.size())).substr(0, 8);
+                taken.insert(slug);
+            }
+            files.push_back(slug + ".html");
+        }
+        return files;
+    }
+
+    // Hash of everything Render() prints for `m`, and of the page markup itself
+    static uint64_t PageHash(const ModelEntity& m) {
+        static const uint64_t layout = [] {
+            uint64_t h = Utils::Fnv1a(&FORMAT, sizeof FORMAT);
+            for (std::string_view piece : {std::string_view(Style()), PAGE_HEAD}) h = Utils::Fnv1a(piece.data(), piece.size(), h);
+            for (std::string_view piece : Markup()) h = Utils::Fnv1a(piece.data(), piece.size(), h);
+            return h;
+        }();
+        uint64_t h = m.OutputHash();
+        auto pod = [&](const auto& v) { h = Utils::Fnv1a(&v, sizeof v, h); };
+        pod(layout);
+        pod(m.metrics.reasoning_score);
+        pod(m.metrics.context_window);
+        pod(m.metrics.org_maturity);
+        pod(m.metrics.uptime_sla);
+        for (const Signal& s : m.signals) {
+            size_t n = s.source.size();
+            pod(n);
+            h = Utils::Fnv1a(s.source.data(), n, h);
+            pod(s.score);
+            pod(s.weight);
+        }
+        return h;
+    }
+
+    static void Render(BufferedWriter& out, const ModelEntity& m) {
+        auto row = [&](std::string_view label) -> BufferedWriter& { return out.Put(ROW_LABEL).Put(label).Put(ROW_VALUE); };
+
+        out << PAGE_HEAD << "    <title>";
+        out.Html(m.name) << " - CrossBench</title>\n    <style>\n" << Style() << "    </style>\n";
+        out << PAGE_BODY;
+        out.Html(m.name) << HEADER_ORG;
+        out.Html(m.organization) << " &middot; " << m.PrimaryType() << " &middot; released " << m.metrics.last_updated_days_ago << " days ago";
+        out << RANKS_OPEN;
+        static constexpr const char* RANK_TITLES[RANK_FIELD_COUNT] = {
+            "Overall", "Best Value", "Coding", "Image Gen", "Video Gen", "Speed", "Confidence", "Enterprise"};
+        for (size_t f = 0; f < RANK_FIELD_COUNT; ++f) {
+            row(RANK_TITLES[f]).Fixed(std::clamp(RankValue(m.ranks, static_cast<RankField>(f)), 0.0, 100.0), 1) << ROW_END;
+        }
+        out << METRICS_OPEN;
+        row("GPQA score").Fixed(m.final_score, 3) << ROW_END;
+        row("Reasoning").Fixed(m.metrics.reasoning_score, 3) << ROW_END;
+        row("Coding").Fixed(m.metrics.coding_score, 3) << ROW_END;
+        row("Creative").Fixed(m.metrics.creative_score, 3) << ROW_END;
+        row("Context window").Fixed(m.metrics.context_window, 3) << ROW_END;
+        row("Input price per 1M");
+        if (m.metrics.price_input_1m >= 999999.0) out << "N/A";
+        else if (m.metrics.price_input_1m > 0) out.Put('$').Fixed(m.metrics.price_input_1m, 2);
+        else out << "Free";
+        out << ROW_END;
+        row("Speed").Fixed(m.metrics.tokens_per_sec, 0) << " tok/s" << ROW_END;
+        row("Uptime SLA").Fixed(m.metrics.uptime_sla * 100.0, 1) << "%" << ROW_END;
+        row("Organization maturity").Fixed(m.metrics.org_maturity, 2) << ROW_END;
+        row("Recency bonus").Integer(m.metrics.recency_bonus) << ROW_END;
+        row("Open source") << (m.metrics.is_open_source ? "Yes" : "No") << ROW_END;
+        row("Enterprise ready") << (m.metrics.is_enterprise_ready ? "Yes" : "No") << ROW_END;
+        out << CONFIDENCE_OPEN;
+        out.Fixed(m.confidence_score, 0) << CONFIDENCE_BAR;
+        out << (m.confidence_score > 80 ? "bg-emerald-500" : m.confidence_score > 50 ? "bg-amber-500" : "bg-rose-500");
+        out << "\" style=\"width: ";
+        out.Fixed(std::clamp(m.confidence_score, 0.0, 100.0), 1) << CONFIDENCE_REASON;
+        // The reason is built as "A, B, " and may end in a separator
+        std::string_view reason = m.confidence_reason;
+        while (!reason.empty() && (reason.back() == ' ' || reason.back() == ',')) reason.remove_suffix(1);
+        out.Html(reason.empty() ? std::string_view("No qualifying factors") : reason);
+        out << SIGNALS_OPEN;
+        for (const Signal& s : m.signals) {
+            out << SIGNAL_SOURCE;
+            out.Html(s.source) << SIGNAL_SCORE;
+            out.Fixed(s.score, 3) << SIGNAL_WEIGHT;
+            out.Fixed(s.weight, 2) << ROW_END;
+        }
+        if (m.signals.empty()) out << NO_SIGNALS;
+        out << PAGE_END;
+    }
+
+    // Class names the page markup uses that the page's stylesheet has no rule for
+    static std::vector<std::string> UnstyledClasses() { return DashboardAssets::Unstyled(Markup(), Style()); }
+
+private:
+    // Purged utilities, THEME and the page rules, as inlined into every page
+    static const std::string& Style() {
+        static const std::string css = DashboardAssets::Stylesheet(Markup()).append(DashboardAssets::THEME).append(PAGE_STYLE);
+        return css;
+    }
+
+    // Bump when Render() changes output without any markup piece changing
+    static constexpr uint32_t FORMAT = 1;
+
+    // File name -> page hash from the last run. Hashes are dropped (not the
+    // files) when the compression setting changed, so every page is rendered
+    // again with the right siblings while removed models are still pruned.
+    static std::unordered_map<std::string, uint64_t> ReadManifest(const std::string& dir, bool compress) {
+        std::unordered_map<std::string, uint64_t> pages;
+        std::ifstream in(dir + "/" + MANIFEST, std::ios::binary);
+        std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::string_view rest = text;
+        auto line = [&] {
+            size_t end = rest.find('\n');
+            std::string_view l = rest.substr(0, end);
+            rest.remove_prefix(end == std::string_view::npos ? rest.size() : end + 1);
+            return l;
+        };
+        std::string_view header = line();
+        if (header.substr(0, 11) != "compressed ") return pages;
+        bool sameSiblings = header.substr(11) == (compress ? "1" : "0");
+        pages.reserve(text.size() / 40);
+        while (!rest.empty()) {
+            std::string_view l = line();
+            size_t space = l.find(' ');
+            if (space == std::string_view::npos || l.find_first_of("/\\", space) != std::string_view::npos) continue;
+            uint64_t hash = 0;
+            auto res = std::from_chars(l.data(), l.data() + space, hash, 16);
+            if (res.ec != std::errc() || res.ptr != l.data() + space) continue;
+            pages.emplace(l.substr(space + 1), sameSiblings ? hash : 0);
+        }
+        return pages;
+    }
+
+    static constexpr std::string_view PAGE_HEAD = R"HTML(<!DOCTYPE html>
+<html lang="en" class="dark">
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0">
+)HTML";
 
-            // Control Type column visibility: show only in Overall, Value, Enterprise, Open Source, Confidence
-            const showTypeColumn = ['overall', 'value', 'enterprise', 'opensource', 'conf'].includes(currentView);
-            // header-modality is now th-type
-            const thType = document.getElementById('th-type');
-            if (thType) thType.style.display = showTypeColumn ? 'table-cell' : 'none';
+    static constexpr std::string_view PAGE_STYLE = R"HTML(        a { color: #60a5fa; }
+)HTML";
 
-            let filtered = models.filter(m => {
-                // Overall tab: Focus on text/LLM models (exclude pure image/video generation models)
-                if (currentView === 'overall') {
-                    // Exclude models that ONLY do image/video (no text capability)
-                    if (!m.meta.is_text) return false;
-                }
-                if (currentView === 'image' && !m.meta.is_image) return false;
-                if (currentView === 'video' && m.ranks.video <= 0) return false; // Show models with video scores > 0
-                if (currentView === 'coding' && m.metrics.coding <= 0) return false;
-                if (currentView === 'enterprise' && !m.meta.is_enterprise) return false;
-                if (currentView === 'opensource' && !m.meta.is_open_source) return false;
-                return true;
-            });
+    // Markup between the values Render() fills in, in page order
+    static constexpr std::string_view PAGE_BODY = R"HTML(</head>
+<body class="min-h-screen">
+    <main class="max-w-7xl mx-auto px-6 py-5">
+        <a href="../leaderboard.html" class="block text-xs font-bold tracking-wider mb-4">&larr; LEADERBOARD</a>
+        <header class="glass rounded-xl p-6 mb-6">
+            <h1 class="text-2xl font-bold text-white">)HTML";
+    static constexpr std::string_view HEADER_ORG = R"HTML(</h1>
+            <div class="text-sm text-slate-400 mt-1">)HTML";
+    static constexpr std::string_view RANKS_OPEN = R"HTML(</div>
+        </header>
+        <div class="grid grid-cols-1 lg:grid-cols-2 gap-6 mb-6">
+            <section class="glass rounded-xl p-5">
+                <h2 class="text-lg font-semibold mb-3 text-white">Rank Scores</h2>
+                <table class="w-full text-sm">
+                    <tbody class="divide-y divide-white/5">
+)HTML";
+    static constexpr std::string_view ROW_LABEL = R"HTML(                        <tr><td class="p-3 text-slate-400">)HTML";
+    static constexpr std::string_view ROW_VALUE = R"HTML(</td><td class="p-3 text-right font-mono text-slate-200">)HTML";
+    static constexpr std::string_view ROW_END = "</td></tr>\n";
+    static constexpr std::string_view METRICS_OPEN = R"HTML(                    </tbody>
+                </table>
+            </section>
+            <section class="glass rounded-xl p-5">
+                <h2 class="text-lg font-semibold mb-3 text-white">Metrics</h2>
+                <table class="w-full text-sm">
+                    <tbody class="divide-y divide-white/5">
+)HTML";
+    static constexpr std::string_view CONFIDENCE_OPEN = R"HTML(                    </tbody>
+                </table>
+            </section>
+        </div>
+        <section class="glass rounded-xl p-5 mb-6">
+            <h2 class="text-lg font-semibold mb-3 text-white">Confidence</h2>
+            <div class="flex items-center gap-4">
+                <div class="font-mono text-2xl font-bold text-blue-400">)HTML";
+    static constexpr std::string_view CONFIDENCE_BAR = R"HTML(%</div>
+                <div class="conf-bar-bg"><div class="conf-bar-fill )HTML";
+    static constexpr std::string_view CONFIDENCE_REASON = R"HTML(%;"></div></div>
+            </div>
+            <p class="text-sm text-slate-400 mt-1">)HTML";
+    static constexpr std::string_view SIGNALS_OPEN = R"HTML(</p>
+        </section>
+        <section class="glass rounded-xl p-5">
+            <h2 class="text-lg font-semibold mb-3 text-white">Signals</h2>
+            <table class="w-full text-sm">
+                <thead class="border-b border-white/10">
+                    <tr>
+                        <th class="p-3 text-left text-xs font-bold text-slate-500 tracking-wider">SOURCE</th>
+                        <th class="p-3 text-right text-xs font-bold text-slate-500 tracking-wider">SCORE</th>
+                        <th class="p-3 text-right text-xs font-bold text-slate-500 tracking-wider">WEIGHT</th>
+                    </tr>
+                </thead>
+                <tbody class="divide-y divide-white/5">
+)HTML";
+    static constexpr std::string_view SIGNAL_SOURCE = R"HTML(                    <tr><td class="p-3 text-slate-300">)HTML";
+    static constexpr std::string_view SIGNAL_SCORE = R"HTML(</td><td class="p-3 text-right font-mono text-blue-400">)HTML";
+    static constexpr std::string_view SIGNAL_WEIGHT = R"HTML(</td><td class="p-3 text-right font-mono text-slate-400">)HTML";
+    static constexpr std::string_view NO_SIGNALS = R"HTML(                    <tr><td colspan="3" class="p-3 text-center text-slate-500">No verified signals</td></tr>
+)HTML";
+    static constexpr std::string_view PAGE_END = R"HTML(                </tbody>
+            </table>
+        </section>
+    </main>
+</body>
+</html>
+)HTML";
 
-            const sortMode = document.getElementById('sortSelect').value;
-            filtered.sort((a,b) => {
-                if (sortMode === 'price_asc') return a.metrics.price - b.metrics.price;
-                if (sortMode === 'speed_desc') return b.metrics.speed - a.metrics.speed;
-                if (sortMode === 'conf_desc') return b.meta.confidence - a.meta.confidence;
-                
-                let scoreA = a.ranks[viewDef.rankKey];
-                let scoreB = b.ranks[viewDef.rankKey];
-                // Fixed: consistent tie-breaker threshold (0.5 points on 0-100 scale)
-                if (Math.abs(scoreA - scoreB) <= 0.5) {
-                    return b.metrics.recency_bonus - a.metrics.recency_bonus;
-                }
-                return scoreB - scoreA;
-            });
+    static const std::vector<std::string_view>& Markup() {
+        static const std::vector<std::string_view> pieces = {
+            PAGE_BODY, HEADER_ORG, RANKS_OPEN, ROW_LABEL, ROW_VALUE, METRICS_OPEN, CONFIDENCE_OPEN, CONFIDENCE_BAR,
+            // The bar colors Render() chooses from
+            R"HTML(class="bg-emerald-500 bg-amber-500 bg-rose-500")HTML",
+            CONFIDENCE_REASON, SIGNALS_OPEN, SIGNAL_SOURCE, SIGNAL_SCORE, SIGNAL_WEIGHT, NO_SIGNALS, PAGE_END};
+        return pieces;
+    }
+};
+
+// --- Export Pipeline ---
+// Runs every writer over one snapshot concurrently. The writers are I/O bound
+// and independent, so each gets its own thread and the export takes as long
+// as the slowest one.
+struct ExportOptions {
+    std::string data_dir = Config::DATA_DIR;
+    std::string output_dir = Config::OUTPUT_DIR;
+    std::string legacy_text = "output.txt";
+    bool compress = false; // Also write .gz/.zst siblings of the text outputs (where compiled in)
+    bool model_pages = true; // Per-model detail pages (ModelPages)
+};
 
-            const tbody = document.getElementById('tableBody');
-            tbody.innerHTML = '';
-            filtered.slice(0, 100).forEach((m, idx) => {
-                // Interactive, hover-only tooltip for recency
-                let badge = '';
-                if(m.metrics.days_ago <= 30) badge = `<span class="ml-2 px-1.5 py-0.5 rounded cursor-help bg-green-500/10 text-green-400 text-[9px] font-bold border border-green-500/20 group relative">NEW<div class="tooltip absolute bottom-full left-1/2 -translate-x-1/2 mb-2 w-max px-3 py-1.5 bg-slate-900 border border-slate-700 rounded shadow-xl text-xs z-50 text-slate-300 font-normal normal-case">Released ${m.metrics.days_ago} days ago</div></span>`;
-
-                let displayScore = m.ranks[viewDef.rankKey];
-                // All scores normalized to 0-100 scale for consistency
-                if (['overall','coding','enterprise','image','video','speed','conf'].includes(currentView) || (currentView === 'opensource')) {
-                    displayScore = displayScore.toFixed(1);
-                } else if (currentView === 'value') {
-                    displayScore = displayScore.toFixed(1);
+class ExportPipeline {
+public:
+    struct Timing {
+        const char* writer;
+        double ms;
+    };
+
+    struct Report {
+        std::vector<Timing> writers;
+        double total_ms = 0.0;
+        size_t failed = 0;
+        std::vector<std::string> failures; // "writer: reason" for each failed writer; callers report them
+        size_t files_replaced = 0;
+        size_t files_unchanged = 0; // Identical to what was on disk, so not rewritten
+        ModelPages::Result pages;
+
+        const Timing& Slowest() const {
+            return *std::max_element(writers.begin(), writers.end(), [](const Timing& a, const Timing& b) { return a.ms < b.ms; });
+        }
+    };
+
+    static Report Run(const ExportSnapshot& snap, const ExportOptions& opt = ExportOptions{}) {
+        Utils::EnsureDirectoryExists(opt.data_dir);
+        Utils::EnsureDirectoryExists(opt.output_dir);
+        Report report;
+        PublishTally tally;
+        // Text output plus its compressed siblings, fed in the same write pass
+        auto text = [&](BufferedWriter& out, const std::string& path) {
+            if (!out) throw std::runtime_error("cannot open " + path);
+            if (opt.compress) Compression::AttachSiblings(out, path, &tally);
+        };
+        auto publish = [](BufferedWriter& out, const std::string& path) {
+            if (!out.Close()) throw std::runtime_error("cannot write " + path);
+        };
+        auto csv = [&](const char* file, const char* type) {
+            std::string path = opt.data_dir + "/" + file;
+            BufferedWriter out(path, std::ios::out, &tally);
+            text(out, path);
+            DataExporter::ExportCSV(out, snap, type);
+            publish(out, path);
+        };
+        const std::pair<const char*, std::function<void()>> writers[] = {
+            {"csv:performance", [&] { csv("leaderboard_performance.csv", "performance"); }},
+            {"csv:price",       [&] { csv("leaderboard_price.csv", "price"); }},
+            {"csv:value",       [&] { csv("leaderboard_value.csv", "value"); }},
+            {"text",            [&] {
+                BufferedWriter out(opt.legacy_text, std::ios::out, &tally);
+                text(out, opt.legacy_text);
+                DataExporter::ExportLegacyText(out, snap);
+                publish(out, opt.legacy_text);
+            }},
+            {"ndjson",          [&] {
+                std::string path = opt.data_dir + "/leaderboard_all.ndjson";
+                BufferedWriter out(path, std::ios::out, &tally);
+                text(out, path);
+                snap.WriteNdjson(out);
+                publish(out, path);
+            }},
+            {"columnar",        [&] {
+                std::string path = opt.data_dir + "/leaderboard_all.cbcol";
+                BufferedWriter out(path, std::ios::out | std::ios::binary, &tally);
+                if (!out) throw std::runtime_error("cannot open " + path);
+                ColumnarExporter::Write(out, snap.registry);
+                publish(out, path);
+            }},
+            {"json",            [&] {
+                std::string path = opt.data_dir + "/leaderboard_all.json";
+                BufferedWriter out(path, std::ios::out, &tally);
+                text(out, path);
+                snap.WritePayload(out);
+                publish(out, path);
+            }},
+            // Hashed files first: the page must never reference one that is not on disk
+            {"dashboard",       [&] {
+                // Rows link the pages the "model pages" writer publishes, under the same names
+                std::vector<std::string> pages;
+                if (opt.model_pages) {
+                    for (std::string& file : ModelPages::FileNames(snap.registry)) pages.push_back(std::string(ModelPages::DIR) + "/" + file);
                 }
-                
-                // Determine appropriate metric display based on view
-                let metricDisplay = '';
-                if (currentView === 'speed') {
-                    metricDisplay = `<div class="text-slate-300">${m.metrics.speed.toFixed(0)} tok/s</div><div class="text-[9px] text-slate-600">throughput</div>`;
-                } else if (currentView === 'video' || currentView === 'image') {
-                    metricDisplay = `<div class="text-slate-300">Creative: ${(m.metrics.creative * 100).toFixed(0)}</div><div class="text-[9px] text-slate-600">generation</div>`;
-                } else if (currentView === 'coding') {
-                    metricDisplay = `<div class="text-slate-300">Code: ${(m.metrics.coding * 100).toFixed(0)}</div><div class="text-[9px] text-slate-600">capability</div>`;
-                } else {
-                    metricDisplay = `<div class="text-slate-300">${m.metrics.price > 0 ? '$' + m.metrics.price.toFixed(2) : 'Free'}</div><div class="text-[9px] text-slate-600">per 1M</div>`;
+                std::vector<DashboardView::ShardFile> shards = DashboardView::WriteShards(snap, opt.output_dir, pages, opt.compress, &tally);
+                DashboardView::PageFiles files = DashboardView::WritePageFiles(snap, opt.output_dir, shards, opt.compress, &tally);
+                std::string path = opt.output_dir + "/leaderboard.html";
+                BufferedWriter html(path, std::ios::out, &tally);
+                text(html, path);
+                DashboardView::Render(html, snap, files, pages);
+                publish(html, path);
+                DashboardView::WriteWorker(opt.output_dir, shards, files, opt.compress, &tally);
+                DashboardView::PruneFiles(opt.output_dir, shards, files);
+            }},
+            {"model pages",     [&] {
+                if (opt.model_pages) report.pages = ModelPages::Write(snap.registry, opt.output_dir, opt.compress, &tally);
+            }}
+        };
+
+        report.writers.resize(std::size(writers));
+        std::vector<std::string> failed(std::size(writers)); // Reason, empty when the writer succeeded
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> pool;
+        for (size_t w = 0; w < std::size(writers); ++w) {
+            pool.emplace_back([&, w] {
+                auto t0 = std::chrono::steady_clock::now();
+                try {
+                    writers[w].second();
+                } catch (const std::exception& e) {
+                    failed[w] = *e.what() ? e.what() : "failed";
                 }
-                
-                let confColor = 'bg-slate-600';
-                if(m.meta.confidence > 80) confColor = 'bg-emerald-500';
-                else if(m.meta.confidence > 50) confColor = 'bg-amber-500';
-                else confColor = 'bg-rose-500';
-
-                // Get primary type from metadata
-                const primaryType = m.meta.primary_type || 'Text';
-                let typeDisplay = primaryType === 'Multimodal' ? 'MULTI' : primaryType.substring(0, 3).toUpperCase();
-
-                 tbody.innerHTML += `
-                    <tr class="hover:bg-white/[0.02] transition-colors border-b border-white/[0.03] last:border-0 group">
-                        <td class="p-4 text-center font-mono font-bold text-slate-600 group-hover:text-blue-500">#${idx + 1}</td>
-                        <td class="p-4">
-                            <div class="flex items-center"><span class="font-bold text-slate-100">${m.name}</span>${badge}</div>
-                            <div class="text-xs font-medium text-slate-500 mt-1">${m.org}</div>
-                        </td>
-                        <td class="p-4 text-center" style="display: ${showTypeColumn ? 'table-cell' : 'none'}"><span class="px-2 py-0.5 rounded bg-slate-800 text-slate-500 text-[10px] uppercase font-bold tracking-wider">${typeDisplay}</span></td>
-                        <td class="p-4 text-right">
-                            <div class="font-mono text-lg font-bold text-blue-400">${displayScore}</div>
-                            <div class="text-[9px] text-slate-600 font-bold uppercase tracking-wider">${viewDef.label}</div>
-                        </td>
-                        <td class="p-4 text-right font-mono text-xs text-slate-400">
-                             ${metricDisplay}
-                        </td>
-                        <td class="p-4">
-                            <div class="flex flex-col gap-1.5 w-full">
-                                <div class="flex justify-between text-[9px] font-bold tracking-wider text-slate-500">
-                                    <span>${m.meta.confidence.toFixed(0)}%</span>
-                                </div>
-                                <div class="conf-bar-bg">
-                                    <div class="conf-bar-fill ${confColor} shadow-[0_0_8px_rgba(0,0,0,0.5)]" style="width: ${m.meta.confidence}%"></div>
-                                </div>
-                            </div>
-                        </td>
-                    </tr>
-                `;
+                report.writers[w] = {writers[w].first, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()};
             });
-            if(filtered.length === 0) tbody.innerHTML = `<tr><td colspan="6" class="p-8 text-center text-slate-500">No models available in this category.</td></tr>`;
         }
-        
-        init();
-    </script>
-</body>
-</html>
-)HTML";
+        for (auto& th : pool) th.join();
+        report.total_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        report.files_replaced = tally.replaced;
+        report.files_unchanged = tally.unchanged;
+        for (size_t w = 0; w < failed.size(); ++w) {
+            if (failed[w].empty()) continue;
+            report.failed++;
+            report.failures.push_back(std::string(report.writers[w].writer) + ": " + failed[w]);
+        }
+        return report;
     }
 };
 
@@ -1128,8 +4867,63 @@ class IntelligenceEngine {
     std::vector<ModelEntity> registry;
     std::vector<ModelEntity> emerging;
     std::map<std::string, OrgStats> orgStats;
+    std::unordered_map<std::string, size_t> nameIndex;
+    ViewOrderings orderings;
+    FragmentCache fragments; // Serialized model records, reused across watch-mode exports
+    ExportOptions exportOptions;
+    std::string weightsPath;
+    std::optional<RuntimeWeightProfile> weights; // Unset: the constant-folded default profile
+
+    double TieThreshold() const {
+        return weights ? weights->tie_threshold : DefaultWeightProfile::tie_threshold;
+    }
+
+    // Invoke `f` with the active weight profile: the default one statically, a
+    // loaded one through the runtime-parameterized kernel.
+    template <typename F>
+    decltype(auto) WithWeights(F&& f) {
+        if (weights) return f(*weights);
+        return f(DefaultWeightProfile{});
+    }
+
+    // Re-read the --weights file and mark every weight that moved.
+    void ReloadWeights(RankChangeSet& changes) {
+        if (weightsPath.empty()) return;
+        std::optional<RuntimeWeightProfile> next = RuntimeWeightProfile::Load(weightsPath);
+        if (!next) {
+            Utils::Log("Weights", "Could not reload " + weightsPath + ", keeping current profile", Utils::YELLOW);
+            return;
+        }
+        RuntimeWeightProfile current = weights.value_or(RuntimeWeightProfile{});
+        for (const auto& e : RuntimeWeightProfile::ENTRIES) {
+            if (current.Get(e.id) != next->Get(e.id)) changes.MarkWeight(e.id);
+        }
+        weights = std::move(next);
+    }
 
 public:
+    bool LoadWeights(const std::string& path) {
+        weights = RuntimeWeightProfile::Load(path);
+        if (!weights) {
+            Utils::Log("Error", "Could not load weight profile " + path, Utils::RED);
+            return false;
+        }
+        weightsPath = path;
+        Utils::Log("Weights", "Using weight profile " + path, Utils::GREEN);
+        return true;
+    }
+
+    // Write .gz/.zst siblings next to every text export
+    void EnableCompression() {
+        std::string formats = Compression::Available();
+        if (formats.empty()) {
+            Utils::Log("Export", "--compress ignored: built without zlib or zstd (see -DCROSSBENCH_ZLIB / -DCROSSBENCH_ZSTD)", Utils::YELLOW);
+            return;
+        }
+        exportOptions.compress = true;
+        Utils::Log("Export", "Writing compressed siblings: " + formats, Utils::GREEN);
+    }
+
     void EnsureCategoryCoverage() {
         // REMOVED: Simulated data injection violates live-data requirement
         // System now operates purely on API-sourced data
@@ -1171,43 +4965,23 @@ public:
                         continue;
                     }
                     
-                    std::string name = item["name"].get<std::string>();
+                    const std::string& name = item["name"].get_ref<const std::string&>();
                     if (name.empty()) {
                         skipped++;
                         continue;
                     }
                     
                     // Check for duplicates
-                    bool exists = false;
-                    for(const auto& r : registry) if(r.name == name) { exists = true; break; }
-                    if(exists) continue;
-
-                    std::string org = item.value("organization", "Unknown");
-                    ModelEntity m(name, org);
-                    
-                    // Parse and validate scores (handle both string and number formats)
-                    double score = 0.0;
-                    if (Utils::TryGetDouble(item, "gpqa_score", score)) {
-                        if (score >= 0.0 && score <= 1.0) {
-                            m.AddSignal("ZeroEval GPQA", score, 0.50);
-                        }
-                    } else if (Utils::TryGetDouble(item, "average_score", score)) {
-                        if (score >= 0.0 && score <= 1.0) {
-                            m.AddSignal("Avg Score", score, 0.40);
-                        }
-                    }
+                    if (nameIndex.count(name)) continue;
 
-                    // Stage 3: Score Computation
-                    m.ComputeAggregates();
-                    // Stage 4: Knowledge Enrichment
-                    KnowledgeBase::Enrich(m, item);
+                    std::optional<ModelEntity> m = BuildEntity(item);
+                    if (!m) continue;
                     // Stage 5: Confidence Recalculation
-                    m.RecalculateConfidence(); // Recalc confidence after enrichment
+                    WithWeights([&](const auto& w) { m->RecalculateConfidence(w); }); // Recalc confidence after enrichment
                     
-                    if (m.final_score > 0) {
-                        registry.push_back(m);
-                        processed++;
-                    }
+                    nameIndex[m->name] = registry.size();
+                    registry.push_back(std::move(*m));
+                    processed++;
                     
                 } catch (const json::exception& e) {
                     std::cout << Utils::YELLOW << "[Warning] Skipping malformed model: " 
@@ -1246,9 +5020,187 @@ public:
         Utils::Log("PostProcess", "Computing ecosystem statistics...", Utils::CYAN);
         EnsureCategoryCoverage();
         ComputeEcosystemShares();
+        orderings.SetTieThreshold(TieThreshold());
+        orderings.Rebuild(registry);
         Utils::Log("PostProcess", "Pipeline complete", Utils::GREEN);
     }
 
+    // Re-fetch the API and fold the differences into the existing registry.
+    // Only the rank fields reachable from changed inputs are recomputed.
+    // Returns the number of models whose ranks were touched.
+    size_t Refresh() {
+        std::string jsonStr = network.Get(Config::API_DOMAIN, Config::API_PATH);
+        if (jsonStr.empty()) {
+            Utils::Log("Refresh", "No data received from API", Utils::YELLOW);
+            return 0;
+        }
+
+        RankChangeSet changes;
+        ReloadWeights(changes);
+        try {
+            auto data = json::parse(jsonStr);
+            if (!data.is_array()) {
+                Utils::Log("Refresh", "Invalid JSON format: expected array", Utils::YELLOW);
+                return 0;
+            }
+            // Views into `data`, which outlives the loop
+            std::unordered_set<std::string_view> seen;
+            // Registry models this poll still lists; models added below are past its end
+            std::vector<char> listed(registry.size());
+            for (const auto& item : data) {
+                try {
+                    if (!item.contains("name") || !item["name"].is_string()) continue;
+                    const std::string& name = item["name"].get_ref<const std::string&>();
+                    if (name.empty() || !seen.insert(name).second) continue;
+
+                    std::optional<ModelEntity> fresh = BuildEntity(item);
+                    if (!fresh) continue;
+
+                    auto it = nameIndex.find(name);
+                    if (it == nameIndex.end()) {
+                        size_t idx = registry.size();
+                        nameIndex[name] = idx;
+                        registry.push_back(std::move(*fresh));
+                        changes.MarkAdded(idx);
+                    } else {
+                        listed[it->second] = 1;
+                        IncrementalRanker::Absorb(registry[it->second], std::move(*fresh), it->second, changes);
+                    }
+                } catch (const std::exception& e) {
+                    std::cout << Utils::YELLOW << "[Warning] Skipping model on refresh: " 
+                              << e.what() << Utils::RESET << std::endl;
+                }
+            }
+            RemoveUnlisted(listed, changes);
+        } catch (const json::exception& e) {
+            Utils::Log("Refresh", "JSON parsing failed: " + std::string(e.what()), Utils::YELLOW);
+            return 0;
+        }
+
+        if (changes.Empty()) {
+            Utils::Log("Refresh", "No changes detected", Utils::CYAN);
+            return 0;
+        }
+        auto stats = WithWeights([&](const auto& w) { return IncrementalRanker::Apply(registry, changes, orderings, w); });
+        orgStats.clear();
+        ComputeEcosystemShares();
+
+        int views = 0;
+        for (size_t v = 0; v < VIEW_COUNT; ++v) if (stats.views_reordered & (1u << v)) views++;
+        Utils::Log("Refresh", std::to_string(stats.models_touched) + " models, " + 
+                  std::to_string(stats.fields_recomputed) + " rank fields recomputed, " + 
+                  std::to_string(stats.models_removed) + " removed, " +
+                  std::to_string(views) + " views reordered", Utils::GREEN);
+        return stats.models_touched + stats.models_removed;
+    }
+
+    // Drop registry models a refresh no longer lists (listed[i] == 0; indices
+    // past `listed` were just added) and renumber everything keyed by index.
+    // A model the API stops returning, or returns without a usable score,
+    // leaves the rankings as it would on a fresh run.
+    void RemoveUnlisted(const std::vector<char>& listed, RankChangeSet& changes) {
+        std::vector<size_t> remap(registry.size());
+        size_t kept = 0;
+        for (size_t i = 0; i < registry.size(); ++i) {
+            remap[i] = (i < listed.size() && !listed[i]) ? ViewOrderings::REMOVED : kept++;
+        }
+        if (kept == registry.size()) return;
+        for (size_t i = 0; i < registry.size(); ++i) {
+            if (remap[i] == ViewOrderings::REMOVED) Utils::Log("Refresh", "Removed " + registry[i].name + " (no longer listed)", Utils::YELLOW);
+            else if (remap[i] != i) registry[remap[i]] = std::move(registry[i]);
+        }
+        registry.erase(registry.begin() + static_cast<std::ptrdiff_t>(kept), registry.end());
+        nameIndex.clear();
+        for (size_t i = 0; i < registry.size(); ++i) nameIndex[registry[i].name] = i;
+        changes.MarkRemoved(remap, orderings.Remove(remap));
+        fragments.Renumber(remap);
+    }
+
+    // Stages 1-4 for a single API item: signals, aggregates and enrichment.
+    // Confidence and ranks are left to the caller.
+    std::optional<ModelEntity> BuildEntity(const json& item) {
+        ModelEntity m(item["name"].get<std::string>(), item.value("organization", "Unknown"));
+        
+        // Parse and validate scores (handle both string and number formats)
+        double score = 0.0;
+        if (Utils::TryGetDouble(item, "gpqa_score", score)) {
+            if (score >= 0.0 && score <= 1.0) {
+                m.AddSignal("ZeroEval GPQA", score, 0.50);
+            }
+        } else if (Utils::TryGetDouble(item, "average_score", score)) {
+            if (score >= 0.0 && score <= 1.0) {
+                m.AddSignal("Avg Score", score, 0.40);
+            }
+        }
+
+        // Stage 3: Score Computation
+        m.ComputeAggregates();
+        // Stage 4: Knowledge Enrichment
+        KnowledgeBase::Enrich(m, item);
+        
+        if (m.final_score <= 0) return std::nullopt;
+        return m;
+    }
+
+    // Overall-ordering stability under perturbed Overall weights
+    void RunSweep(const Sweep::Options& opt) {
+        Utils::Log("Sweep", "Evaluating " + std::to_string(opt.samples) + " weight vectors (+/-" + 
+                  std::to_string(static_cast<int>(opt.span * 100)) + "%)...", Utils::CYAN);
+        Sweep::Report report = WithWeights([&](const auto& w) {
+            return Sweep::Engine(registry, orderings.Order(ViewId::Overall), w).Run(opt);
+        });
+
+        // Published through AtomicFile like every other data/ output
+        std::string path = Config::DATA_DIR + "/weight_sensitivity.json";
+        BufferedWriter out(path);
+        if (out) out << Sweep::ToJSON(report, registry).dump(2);
+        const bool written = out && out.Close();
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(0) << report.elapsed_ms << " ms ("
+           << (report.options.samples / std::max(report.elapsed_ms, 1e-3) * 1000.0) << " samples/s)";
+        Utils::Log("Sweep", "Completed in " + os.str(), Utils::GREEN);
+        for (size_t r = 0; r < std::min<size_t>(10, report.models.size()); ++r) {
+            const auto& m = report.models[r];
+            std::cout << "  #" << m.base_rank << " " << registry[m.index].name << ": rank " << m.min_rank << "-" << m.max_rank
+                      << ", top-10 in " << std::setprecision(1) << (m.top10_rate * 100.0) << "% of samples" << std::endl;
+        }
+        for (size_t i = 0; i < std::min<size_t>(5, report.flips.size()); ++i) {
+            const auto& f = report.flips[i];
+            std::cout << Utils::YELLOW << "  [Flip] " << registry[f.index].name << (f.enters ? " enters" : " leaves") 
+                      << " the top 10 in " << std::setprecision(1) << (100.0 * f.count / report.options.samples) 
+                      << "% of samples" << Utils::RESET << std::endl;
+        }
+        if (written) Utils::Log("Sweep", "Report written to " + path, Utils::GREEN);
+        else Utils::Log("Sweep", "Cannot write " + path + "; previous report left in place", Utils::RED);
+    }
+
+    // Rank confidence intervals per view from resampled signals and metrics
+    void RunBootstrap(const Resample::Options& opt) {
+        Utils::Log("Bootstrap", "Resampling " + std::to_string(opt.iterations) + " iterations...", Utils::CYAN);
+        Resample::Report report = WithWeights([&](const auto& w) {
+            return Resample::Engine(registry, orderings, opt.noise).Run(opt, w);
+        });
+
+        // Published through AtomicFile like every other data/ output
+        std::string path = Config::DATA_DIR + "/rank_confidence.json";
+        BufferedWriter out(path);
+        if (out) out << Resample::ToJSON(report, registry).dump(2);
+        const bool written = out && out.Close();
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(0) << report.elapsed_ms << " ms";
+        Utils::Log("Bootstrap", "Completed in " + os.str(), Utils::GREEN);
+        const auto& overall = report.views[static_cast<size_t>(ViewId::Overall)];
+        for (size_t r = 0; r < std::min<size_t>(10, overall.size()); ++r) {
+            const auto& iv = overall[r];
+            std::cout << "  #" << iv.base_rank << " " << registry[iv.index].name << ": 95% CI [" 
+                      << iv.lo << ", " << iv.hi << "], median " << iv.median << std::endl;
+        }
+        if (written) Utils::Log("Bootstrap", "Intervals written to " + path, Utils::GREEN);
+        else Utils::Log("Bootstrap", "Cannot write " + path + "; previous intervals left in place", Utils::RED);
+    }
+
     void ComputeEcosystemShares() {
         for (const auto& m : registry) {
             std::string org = m.organization;
@@ -1259,43 +5211,688 @@ public:
     }
 
     void ExportAll() {
-        std::string jsonOut = ProcessToJSON();
-        DataExporter::ExportJSON("data/leaderboard_all.json", jsonOut);
-        DataExporter::ExportCSV("data/leaderboard_performance.csv", registry, "performance");
-        DataExporter::ExportCSV("data/leaderboard_price.csv", registry, "price");
-        DataExporter::ExportCSV("data/leaderboard_value.csv", registry, "value");
-        DataExporter::ExportLegacyText("output.txt", registry);
-        DashboardView::Render(jsonOut);
-        std::cout << Utils::GREEN << "[Export] Generated 3 CSV files + JSON + HTML" << Utils::RESET << std::endl;
-    }
-
-    std::string ProcessToJSON() {
-        json jRoot;
-        json jModels = json::array();
-        for (const auto& m : registry) jModels.push_back(m.ToJSON());
-        jRoot["models"] = jModels;
-        
-        json jEcosystem = json::object();
-        for (auto& [org, s] : orgStats) {
-             double avg = (s.model_count > 0) ? (s.avg_score / s.model_count) : 0.0;
-             double score = (s.model_count * 0.4) + (avg * 10.0 * 0.3);
-             jEcosystem[org] = score;
+        ExportSnapshot snap = ExportSnapshot::Build(registry, orderings, orgStats, &fragments);
+        ExportPipeline::Report report = ExportPipeline::Run(snap, exportOptions);
+        if (report.failed == 0) {
+            std::cout << Utils::GREEN << "[Export] Generated 3 CSV files + JSON + NDJSON + columnar + HTML + model pages" << Utils::RESET << std::endl;
+        } else {
+            // Failed writers left their previous files in place
+            for (const std::string& failure : report.failures) Utils::Log("Export", "Writer " + failure, Utils::RED);
+            Utils::Log("Export", std::to_string(report.failed) + " of " + std::to_string(report.writers.size()) +
+                       " writers failed; their outputs were not updated", Utils::RED);
         }
-        jRoot["ecosystem"] = jEcosystem;
-        
-        return jRoot.dump();
+        const auto& slowest = report.Slowest();
+        std::cout << Utils::CYAN << "[Export] " << std::fixed << std::setprecision(1) << report.total_ms 
+                  << " ms (slowest writer: " << slowest.writer << ", " << slowest.ms << " ms), "
+                  << snap.fragments_rebuilt << "/" << registry.size() << " model records re-serialized, "
+                  << report.pages.rendered << "/" << registry.size() << " model pages rendered, "
+                  << report.files_replaced << " files rewritten, " << report.files_unchanged << " unchanged" << Utils::RESET << std::endl;
     }
 };
 
-int main() {
+// --- Benchmarks ---
+namespace Bench {
+    // Deterministic synthetic catalog so --bench runs without the network
+    std::vector<ModelEntity> SyntheticRegistry(size_t n, uint64_t seed = 42) {
+        static const char* ORGS[] = {"OpenAI", "Anthropic", "Google", "Microsoft", "Meta", "Mistral AI", "DeepSeek", "xAI"};
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+        std::vector<ModelEntity> registry;
+        registry.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            ModelEntity m("Synthetic Model " + std::to_string(i), ORGS[i % 8]);
+            m.AddSignal("ZeroEval GPQA", 0.15 + 0.7 * u(rng), 0.50);
+            if (u(rng) < 0.3) m.AddSignal("Avg Score", 0.15 + 0.7 * u(rng), 0.40);
+            m.modalities.insert(Modality::Text);
+            if (u(rng) < 0.3) m.modalities.insert(Modality::Image);
+            if (u(rng) < 0.05) m.modalities.insert(Modality::Video);
+            m.metrics.last_updated_days_ago = static_cast<int>(u(rng) * 400);
+            m.ComputeAggregates();
+            m.metrics.reasoning_score = m.final_score;
+            m.metrics.coding_score = m.final_score * (0.8 + 0.3 * u(rng));
+            m.metrics.creative_score = std::min(1.0, m.final_score * (0.8 + 0.3 * u(rng)));
+            m.metrics.context_window = u(rng);
+            m.metrics.price_input_1m = (u(rng) < 0.2) ? 0.0 : 0.05 + 20.0 * u(rng);
+            m.metrics.tokens_per_sec = 20.0 + 200.0 * u(rng);
+            m.metrics.is_enterprise_ready = (i % 8) < 4;
+            m.metrics.is_open_source = (i % 8) >= 4 && u(rng) < 0.6;
+            m.metrics.org_maturity = m.metrics.is_enterprise_ready ? 0.95 : 0.5;
+            m.metrics.uptime_sla = m.metrics.is_enterprise_ready ? 0.99 : 0.8;
+            m.RecalculateConfidence();
+            registry.push_back(std::move(m));
+        }
+        return registry;
+    }
+
+    template <typename F>
+    double TimeMs(F&& f) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Ranking kernel: constant-folded default profile vs the runtime-parameterized
+    // kernel fed the same values. Both must produce identical ranks.
+    bool RankKernels(std::vector<ModelEntity>& registry) {
+        // The weights a file would supply: read through a volatile so the compiler
+        // cannot fold this profile's defaults as well
+        RuntimeWeightProfile loaded;
+        volatile double one = 1.0;
+        for (const auto& e : RuntimeWeightProfile::ENTRIES) loaded.*(e.member) *= one;
+
+        // The profiles must agree through the full recalculation, confidence included
+        for (auto& m : registry) m.RecalculateConfidence(DefaultWeightProfile{});
+        std::vector<RankScores> expected;
+        expected.reserve(registry.size());
+        for (const auto& m : registry) expected.push_back(m.ranks);
+        for (auto& m : registry) m.RecalculateConfidence(loaded);
+        double maxDiff = 0.0;
+        for (size_t i = 0; i < registry.size(); ++i) {
+            for (size_t f = 0; f < RANK_FIELD_COUNT; ++f) {
+                RankField field = static_cast<RankField>(f);
+                maxDiff = std::max(maxDiff, std::abs(RankValue(registry[i].ranks, field) - RankValue(expected[i], field)));
+            }
+        }
+        bool agree = maxDiff <= 1e-9;
+        Utils::Log("Bench", agree ? "Rank kernels agree" : "Rank kernels DISAGREE (max diff " + std::to_string(maxDiff) + ")",
+                   agree ? Utils::GREEN : Utils::RED);
+
+        // Timing covers the kernel alone: RecalculateConfidence() also builds the
+        // confidence reason strings, which cost more than the kernel and hide it
+        std::vector<RankInputs> inputs;
+        inputs.reserve(registry.size());
+        for (const auto& m : registry) inputs.push_back(m.Inputs());
+        std::vector<RankScores> out(inputs.size());
+        const int reps = static_cast<int>(std::max<size_t>(1, 500000 / inputs.size()));
+        constexpr int ROUNDS = 15;
+        auto pass = [&](const auto& profile) {
+            return TimeMs([&] {
+                for (int r = 0; r < reps; ++r) {
+                    for (size_t i = 0; i < inputs.size(); ++i) ModelEntity::RankKernel(inputs[i], ALL_RANK_FIELDS, out[i], profile);
+                }
+            });
+        };
+        // Warm-up, then alternating rounds keeping each kernel's best, so neither
+        // gets the cold caches or the clock ramp to itself
+        pass(DefaultWeightProfile{});
+        pass(loaded);
+        double staticMs = std::numeric_limits<double>::infinity(), runtimeMs = staticMs;
+        for (int round = 0; round < ROUNDS; ++round) {
+            staticMs = std::min(staticMs, pass(DefaultWeightProfile{}));
+            runtimeMs = std::min(runtimeMs, pass(loaded));
+        }
+
+        double evals = static_cast<double>(reps) * inputs.size();
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1)
+           << "default profile " << (staticMs * 1e6 / evals) << " ns/model, runtime profile "
+           << (runtimeMs * 1e6 / evals) << " ns/model (" << reps << " x " << inputs.size() << ", best of " << ROUNDS << ")";
+        Utils::Log("Bench", "Rank kernel: " + os.str(), Utils::CYAN);
+        // Folding only saves the weight loads (strict IEEE arithmetic keeps every
+        // multiply), so the two are expected to tie; slower beyond noise is a regression
+        if (staticMs > runtimeMs * 1.10) Utils::Log("Bench", "Constant-folded default profile is slower than the runtime profile", Utils::YELLOW);
+        return agree;
+    }
+
+    // Weight sweep throughput on a catalog-sized slice of the Overall view
+    void WeightSweep(const std::vector<ModelEntity>& registry) {
+        ViewOrderings views;
+        views.Rebuild(registry);
+        std::vector<size_t> overall = views.Order(ViewId::Overall);
+        overall.resize(std::min<size_t>(overall.size(), 500));
+        Sweep::Options opt;
+        opt.samples = 20000;
+        Sweep::Report report = Sweep::Engine(registry, overall, DefaultWeightProfile{}).Run(opt);
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(0) << (opt.samples / std::max(report.elapsed_ms, 1e-3) * 1000.0)
+           << " samples/s over " << overall.size() << " models";
+        Utils::Log("Bench", "Weight sweep: " + os.str(), Utils::CYAN);
+    }
+
+    // Bootstrap intervals: the same iterations on one thread and on four must
+    // agree exactly; logs the runtime and the histogram memory each thread holds
+    bool Bootstrap(size_t n) {
+        std::vector<ModelEntity> registry = SyntheticRegistry(n, 11);
+        ViewOrderings views;
+        views.Rebuild(registry);
+        Resample::Options opt;
+        opt.iterations = 400;
+        Resample::Engine engine(registry, views, opt.noise);
+        opt.threads = 1;
+        Resample::Report single = engine.Run(opt, DefaultWeightProfile{});
+        opt.threads = 4;
+        Resample::Report pooled = engine.Run(opt, DefaultWeightProfile{});
+
+        size_t mismatches = 0;
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            const auto& a = single.views[v];
+            const auto& b = pooled.views[v];
+            if (a.size() != b.size()) { mismatches += std::max(a.size(), b.size()); continue; }
+            for (size_t j = 0; j < a.size(); ++j) {
+                if (a[j].index != b[j].index || a[j].lo != b[j].lo || a[j].median != b[j].median ||
+                    a[j].hi != b[j].hi || a[j].mean != b[j].mean) ++mismatches;
+            }
+        }
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << opt.iterations << " iterations over " << n << " models: "
+           << single.elapsed_ms << " ms on 1 thread, " << pooled.elapsed_ms << " ms on 4; "
+           << engine.ScratchBytes() / 1024 << " KB histograms per thread";
+        Utils::Log("Bench", "Bootstrap: " + os.str(), Utils::CYAN);
+        if (mismatches) {
+            Utils::Log("Bench", std::to_string(mismatches) + " bootstrap intervals depend on the thread count", Utils::YELLOW);
+            return false;
+        }
+        return true;
+    }
+
+    // Randomized check of the shared leaderboard ordering: it must be a strict
+    // weak ordering on random triples, and every view must come out identical
+    // no matter how the registry is shuffled.
+    bool OrderingDeterminism(size_t n) {
+        std::vector<ModelEntity> registry = SyntheticRegistry(n, 7);
+        std::mt19937_64 rng(1234);
+        std::uniform_int_distribution<size_t> pick(0, registry.size() - 1);
+        const double tie = Config::Weights::TIE_THRESHOLD;
+        size_t violations = 0;
+        for (int t = 0; t < 200000; ++t) {
+            const ModelEntity& a = registry[pick(rng)];
+            const ModelEntity& b = registry[pick(rng)];
+            const ModelEntity& c = registry[pick(rng)];
+            RankField f = Views::ALL[t % VIEW_COUNT].field;
+            bool ab = Views::Before(a, b, f, tie), ba = Views::Before(b, a, f, tie);
+            bool bc = Views::Before(b, c, f, tie), ac = Views::Before(a, c, f, tie);
+            if (Views::Before(a, a, f, tie) || (ab && ba) || (ab && bc && !ac)) violations++;
+        }
+
+        auto names = [&](const ViewOrderings& views) {
+            std::vector<std::string> out;
+            for (size_t v = 0; v < VIEW_COUNT; ++v) {
+                for (size_t idx : views.Order(static_cast<ViewId>(v))) out.push_back(registry[idx].name);
+                out.emplace_back(); // View separator
+            }
+            return out;
+        };
+        ViewOrderings views;
+        views.Rebuild(registry);
+        const std::vector<std::string> expected = names(views);
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            // The key-sorted RankingIndex must agree with the comparator itself
+            const auto& ord = views.Order(static_cast<ViewId>(v));
+            if (!std::is_sorted(ord.begin(), ord.end(), [&](size_t a, size_t b) {
+                    return Views::Before(registry[a], registry[b], Views::ALL[v].field, tie); })) violations++;
+        }
+        int mismatches = 0;
+        for (int round = 0; round < 10; ++round) {
+            std::shuffle(registry.begin(), registry.end(), rng);
+            views.Rebuild(registry);
+            if (names(views) != expected) mismatches++;
+        }
+
+        // A tiny threshold gives buckets far past 32 bits: rebuilt views must
+        // still follow the comparator, and splicing moved models in must give
+        // what a rebuild gives
+        const double fineTie = 1e-12;
+        ViewOrderings fine;
+        fine.SetTieThreshold(fineTie);
+        fine.Rebuild(registry);
+        std::vector<std::pair<size_t, ViewMask>> moved;
+        for (size_t i = 0; i < registry.size(); i += 50) {
+            registry[i].ranks.overall += 0.37;
+            moved.push_back({i, ALL_VIEWS});
+        }
+        fine.Update(registry, moved);
+        for (size_t v = 0; v < VIEW_COUNT; ++v) {
+            const auto& ord = fine.Order(static_cast<ViewId>(v));
+            if (!std::is_sorted(ord.begin(), ord.end(), [&](size_t a, size_t b) {
+                    return Views::Before(registry[a], registry[b], Views::ALL[v].field, fineTie); })) violations++;
+        }
+        ViewOrderings rebuilt;
+        rebuilt.SetTieThreshold(fineTie);
+        rebuilt.Rebuild(registry);
+        if (names(fine) != names(rebuilt)) mismatches++;
+
+        bool ok = violations == 0 && mismatches == 0;
+        Utils::Log("Bench", ok ? "Leaderboard ordering is a strict weak ordering and shuffle-invariant (" + std::to_string(n) + " models)"
+                               : "Leaderboard ordering check FAILED (" + std::to_string(violations) + " ordering violations, " +
+                                 std::to_string(mismatches) + " shuffled mismatches)", ok ? Utils::GREEN : Utils::RED);
+        return ok;
+    }
+
+    // Export row selection: one name-ranked index, then top-K per export
+    void ExportSelection(const std::vector<ModelEntity>& registry) {
+        const double tie = Config::Weights::TIE_THRESHOLD;
+        size_t rows = 0;
+        double ms = TimeMs([&] {
+            RankingIndex ranking(registry);
+            rows += ranking.Top(RankField::Overall, tie, 100, [](const ModelEntity&) { return true; }).size();
+            rows += ranking.Top(RankField::Value, tie, 100, [](const ModelEntity& m) { return m.ranks.value > 0.0; }).size();
+            rows += ranking.Lowest(100, [](const ModelEntity&) { return true; }, [](const ModelEntity& m) { return m.metrics.price_input_1m; }).size();
+            rows += ranking.Top(RankField::Overall, tie, 50, [](const ModelEntity&) { return true; }).size();
+        });
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << ms << " ms for " << rows << " rows from " << registry.size() << " models";
+        Utils::Log("Bench", "Export selection: " + os.str(), Utils::CYAN);
+    }
+
+    bool CsvEscaping() {
+        const std::pair<const char*, const char*> cases[] = {
+            {"Plain Model", "Plain Model"},
+            {"Acme, Inc", "\"Acme, Inc\""},
+            {"Say \"hi\"", "\"Say \"\"hi\"\"\""},
+            {"two\nlines", "\"two\nlines\""},
+            {"a long name without any special bytes", "a long name without any special bytes"},
+            {"a long name ending in a quote\"", "\"a long name ending in a quote\"\"\""},
+            {"", ""}
+        };
+        bool ok = true;
+        for (const auto& [in, expected] : cases) {
+            std::ostringstream os;
+            BufferedWriter(os).CsvField(in);
+            if (os.str() != expected) {
+                Utils::Log("Bench", std::string("CSV escaping mismatch for: ") + in, Utils::YELLOW);
+                ok = false;
+            }
+        }
+        if (ok) Utils::Log("Bench", "CSV escaping is RFC 4180 compliant", Utils::GREEN);
+        return ok;
+    }
+
+    // A writer that throws partway through leaves the published file as it was, with no temp file behind
+    bool InterruptedWrite() {
+        fs::path path = fs::temp_directory_path() / "crossbench_interrupted.txt";
+        {
+            BufferedWriter out(path.string());
+            out << "complete\n";
+            out.Close();
+        }
+        try {
+            BufferedWriter out(path.string());
+            out << "partial";
+            out.Flush();
+            throw std::runtime_error("writer failed");
+        } catch (const std::exception&) {
+        }
+        std::ifstream in(path, std::ios::binary);
+        std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        bool ok = text == "complete\n" && !fs::exists(path.string() + ".tmp");
+        std::error_code ec;
+        fs::remove(path, ec);
+        if (ok) Utils::Log("Bench", "Interrupted write keeps the previous file", Utils::GREEN);
+        else Utils::Log("Bench", "Interrupted write replaced the previous file", Utils::YELLOW);
+        return ok;
+    }
+
+    // Rows/sec for a performance-style CSV, iostream formatting vs BufferedWriter
+    void CsvThroughput(const std::vector<ModelEntity>& registry, size_t rows = 1000000) {
+        fs::path path = fs::temp_directory_path() / "crossbench_rows.csv";
+        double streamMs = TimeMs([&] {
+            std::ofstream out(path);
+            for (size_t r = 0; r < rows; ++r) {
+                const ModelEntity& m = registry[r % registry.size()];
+                out << r + 1 << "," << m.name << "," << m.organization << ","
+                    << std::fixed << std::setprecision(3) << m.final_score << ","
+                    << std::to_string(m.metrics.price_input_1m) << ","
+                    << std::fixed << std::setprecision(2) << m.ranks.overall << "\n";
+            }
+        });
+        std::error_code ec;
+        fs::remove(path, ec); // Otherwise the writer only compares against identical text
+        double writerMs = TimeMs([&] {
+            BufferedWriter out(path.string());
+            for (size_t r = 0; r < rows; ++r) {
+                const ModelEntity& m = registry[r % registry.size()];
+                out.Integer(static_cast<long long>(r + 1)).Put(',').CsvField(m.name).Put(',').CsvField(m.organization).Put(',')
+                   .Fixed(m.final_score, 3).Put(',').Fixed(m.metrics.price_input_1m, 6).Put(',')
+                   .Fixed(m.ranks.overall, 2).Put('\n');
+            }
+            out.Close();
+        });
+        fs::remove(path, ec);
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(0) << rows / (streamMs / 1000.0) << " rows/s with iostream, "
+           << rows / (writerMs / 1000.0) << " rows/s with BufferedWriter (" << rows << " rows)";
+        Utils::Log("Bench", "CSV formatting: " + os.str(), Utils::CYAN);
+    }
+
+    // Cold vs warm fragment cache with 1% churn; the spliced payload must match a fresh one
+    bool FragmentReuse(std::vector<ModelEntity>& registry) {
+        ViewOrderings views;
+        views.Rebuild(registry);
+        std::map<std::string, OrgStats> orgStats;
+        FragmentCache cache;
+        size_t cold = 0, warm = 0;
+        double coldMs = TimeMs([&] { cold = ExportSnapshot::Build(registry, views, orgStats, &cache).fragments_rebuilt; });
+        for (size_t i = 0; i < registry.size(); i += 100) registry[i].ranks.overall += 0.01;
+        std::optional<ExportSnapshot> snap;
+        double warmMs = TimeMs([&] { snap.emplace(ExportSnapshot::Build(registry, views, orgStats, &cache)); });
+        warm = snap->fragments_rebuilt;
+
+        std::string spliced, fresh;
+        { BufferedWriter out(&spliced); snap->WritePayload(out); }
+        { BufferedWriter out(&fresh); ExportSnapshot::Build(registry, views, orgStats).WritePayload(out); }
+        for (size_t i = 0; i < registry.size(); i += 100) registry[i].ranks.overall -= 0.01;
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << "cold " << coldMs << " ms (" << cold << " records), warm "
+           << warmMs << " ms (" << warm << " records)";
+        Utils::Log("Bench", "Fragment cache: " + os.str(), Utils::CYAN);
+        if (spliced != fresh) {
+            Utils::Log("Bench", "Cached JSON payload differs from a fresh serialization", Utils::YELLOW);
+            return false;
+        }
+        return true;
+    }
+
+    // Model pages: a cold render, a re-run that renders nothing, then a re-run
+    // after every 100th model changed, which must render exactly those
+    bool ModelPageReuse(size_t n) {
+        std::vector<ModelEntity> registry = SyntheticRegistry(n);
+        fs::path dir = fs::temp_directory_path() / "crossbench_pages";
+        std::error_code ec;
+        fs::remove_all(dir, ec);
+        ModelPages::Result cold, same, churn;
+        double coldMs = TimeMs([&] { cold = ModelPages::Write(registry, dir.string()); });
+        double sameMs = TimeMs([&] { same = ModelPages::Write(registry, dir.string()); });
+        size_t changed = 0;
+        for (size_t i = 0; i < registry.size(); i += 100, ++changed) registry[i].ranks.overall += 0.01;
+        double churnMs = TimeMs([&] { churn = ModelPages::Write(registry, dir.string()); });
+
+        // A re-rendered page is what a fresh render prints
+        std::string fresh;
+        { BufferedWriter out(&fresh); ModelPages::Render(out, registry[0]); }
+        std::ifstream page(dir / ModelPages::DIR / ModelPages::FileNames(registry)[0], std::ios::binary);
+        std::string onDisk((std::istreambuf_iterator<char>(page)), std::istreambuf_iterator<char>());
+        page.close();
+        fs::remove_all(dir, ec);
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << n << " pages cold " << coldMs << " ms, unchanged " << sameMs
+           << " ms (" << same.rendered << " rendered), " << changed << " changed " << churnMs << " ms (" << churn.rendered << " rendered)";
+        Utils::Log("Bench", "Model pages: " + os.str(), Utils::CYAN);
+        bool ok = cold.rendered == n && same.rendered == 0 && churn.rendered == changed;
+        if (!ok) Utils::Log("Bench", "Model pages were rendered without a content change, or missed one", Utils::YELLOW);
+        if (onDisk != fresh) {
+            Utils::Log("Bench", "Model page on disk differs from a fresh render", Utils::YELLOW);
+            ok = false;
+        }
+        if (fresh.find("://") != std::string::npos) {
+            Utils::Log("Bench", "Model page references an external URL", Utils::YELLOW);
+            ok = false;
+        }
+        for (const std::string& name : ModelPages::UnstyledClasses()) {
+            Utils::Log("Bench", "Model page class has no compiled rule: " + name, Utils::YELLOW);
+            ok = false;
+        }
+        return ok;
+    }
+
+    // Columnar export round trip through the mapped reader, against the JSON parse it replaces
+    bool ColumnarRoundTrip(const std::vector<ModelEntity>& registry) {
+        fs::path path = fs::temp_directory_path() / "crossbench_bench.cbcol";
+        double writeMs = TimeMs([&] {
+            BufferedWriter out(path.string(), std::ios::out | std::ios::binary);
+            ColumnarExporter::Write(out, registry);
+            out.Close();
+        });
+
+        bool ok = true;
+        double sum = 0.0;
+        double readMs = TimeMs([&] {
+            std::optional<Columnar::MappedFile> file = Columnar::MappedFile::Open(path.string());
+            std::optional<Columnar::Reader> reader = file ? Columnar::Reader::Open(file->Data(), file->Size()) : std::nullopt;
+            std::optional<Columnar::Column> overall = reader ? reader->Find("ranks.overall") : std::nullopt;
+            std::optional<Columnar::Column> names = reader ? reader->Find("name") : std::nullopt;
+            if (!overall || !names || overall->Size() != registry.size()) { ok = false; return; }
+            for (size_t i = 0; i < overall->Size(); ++i) {
+                sum += overall->F64(i);
+                if (overall->F64(i) != std::clamp(registry[i].ranks.overall, 0.0, 100.0)) ok = false;
+            }
+            for (size_t i = 0; i < registry.size(); i += 997) {
+                if (names->String(i) != registry[i].name) ok = false;
+            }
+        });
+        uintmax_t bytes = fs::file_size(path);
+        std::error_code ec;
+        fs::remove(path, ec);
+
+        ViewOrderings views;
+        views.Rebuild(registry);
+        std::string payload;
+        { BufferedWriter out(&payload); ExportSnapshot::Build(registry, views, {}).WritePayload(out); }
+        double parseMs = TimeMs([&] { sum += json::parse(payload)["models"].size(); });
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << "write " << writeMs << " ms (" << bytes / 1024 << " KB), map + read one column "
+           << readMs << " ms vs JSON parse " << parseMs << " ms (" << payload.size() / 1024 << " KB)";
+        Utils::Log("Bench", "Columnar export: " + os.str(), Utils::CYAN);
+        if (!ok) Utils::Log("Bench", "Columnar reader disagrees with the registry", Utils::YELLOW);
+        return ok;
+    }
+
+    // Every NDJSON line must parse to the matching record of the JSON payload
+    bool NdjsonRecords(const std::vector<ModelEntity>& registry) {
+        ViewOrderings views;
+        views.Rebuild(registry);
+        std::map<std::string, OrgStats> orgStats;
+        for (const auto& m : registry) orgStats[m.organization].model_count++;
+        ExportSnapshot snap = ExportSnapshot::Build(registry, views, orgStats);
+        std::string payload, lines;
+        { BufferedWriter out(&payload); snap.WritePayload(out); }
+        double writeMs = TimeMs([&] { BufferedWriter out(&lines); snap.WriteNdjson(out); });
+
+        json doc = json::parse(payload);
+        size_t count = 0;
+        bool ok = true;
+        std::istringstream in(lines);
+        std::string line;
+        while (std::getline(in, line)) {
+            json record = json::parse(line);
+            if (count < registry.size()) ok = ok && record == doc["models"][count];
+            else ok = ok && record == json{{"ecosystem", doc["ecosystem"]}};
+            count++;
+        }
+        ok = ok && count == registry.size() + 1;
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << count << " lines, " << lines.size() / 1024 << " KB in " << writeMs << " ms";
+        Utils::Log("Bench", "NDJSON export: " + os.str(), Utils::CYAN);
+        if (!ok) Utils::Log("Bench", "NDJSON records differ from the JSON payload", Utils::YELLOW);
+        return ok;
+    }
+
+    // Dashboard search index: build cost, lookups against a linear scan of the same entries
+    bool SearchLookup(const std::vector<ModelEntity>& registry) {
+        ViewOrderings views;
+        views.Rebuild(registry);
+        ExportSnapshot snap = ExportSnapshot::Build(registry, views, {});
+        std::optional<SearchIndex> index;
+        double buildMs = TimeMs([&] { index.emplace(SearchIndex::Build(snap)); });
+        std::string written;
+        { BufferedWriter out(&written); index->Write(out, snap); }
+
+        std::mt19937_64 rng(99);
+        std::vector<std::string> queries = {"model 1", "SYNTHETIC", "xai", "op", "ai", "zz"};
+        for (size_t i = 0; i < 200 && !registry.empty(); ++i) {
+            const ModelEntity& m = registry[rng() % registry.size()];
+            const std::string& text = (i % 4 == 0) ? m.organization : m.name;
+            size_t len = 2 + rng() % 6, at = rng() % text.size();
+            queries.push_back(text.substr(at, len));
+        }
+
+        bool ok = true;
+        std::vector<std::vector<uint32_t>> found(queries.size());
+        double findMs = TimeMs([&] {
+            for (size_t q = 0; q < queries.size(); ++q) found[q] = index->Find(snap, queries[q], 20);
+        });
+        for (size_t q = 0; q < queries.size(); ++q) {
+            // Same rules as Find: trimmed, folded, two characters match word starts
+            std::string needle = SearchIndex::Fold(queries[q]);
+            needle.erase(needle.find_last_not_of(' ') + 1);
+            needle.erase(0, std::min(needle.find_first_not_of(' '), needle.size()));
+            std::vector<uint32_t> expected;
+            if (needle.size() >= 2) {
+                if (needle.size() == 2) needle.insert(needle.begin(), ' ');
+                for (uint32_t e = 0; e < index->entries.size() && expected.size() < 20; ++e) {
+                    const ModelEntity& m = registry[index->entries[e].model];
+                    if (SearchIndex::Fold(m.name).find(needle) != std::string::npos ||
+                        SearchIndex::Fold(m.organization).find(needle) != std::string::npos) expected.push_back(e);
+                }
+            }
+            if (found[q] != expected) {
+                Utils::Log("Bench", "Search for \"" + queries[q] + "\" disagrees with a linear scan", Utils::YELLOW);
+                ok = false;
+            }
+        }
+
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << index->grams.size() << " grams, " << written.size() / 1024 << " KB, built in "
+           << buildMs << " ms; " << queries.size() << " lookups " << std::setprecision(2) << findMs * 1000.0 / queries.size() << " us each";
+        Utils::Log("Bench", "Search index: " + os.str(), Utils::CYAN);
+        return ok;
+    }
+
+    // Snapshot build plus concurrent writers into a scratch directory
+    bool ExportWriters(const std::vector<ModelEntity>& registry) {
+        fs::path dir = fs::temp_directory_path() / "crossbench_bench";
+        std::error_code ec;
+        fs::remove_all(dir, ec);
+        ExportOptions paths{(dir / "data").string(), (dir / "output").string(), (dir / "output.txt").string()};
+        paths.model_pages = false; // ModelPageReuse covers them at a size that suits the disk
+        ViewOrderings views;
+        views.Rebuild(registry);
+        std::map<std::string, OrgStats> orgStats;
+        for (const auto& m : registry) {
+            orgStats[m.organization].model_count++;
+            orgStats[m.organization].avg_score += m.final_score;
+        }
+        std::optional<ExportSnapshot> snap;
+        double buildMs = TimeMs([&] { snap.emplace(ExportSnapshot::Build(registry, views, orgStats)); });
+        ExportPipeline::Report report = ExportPipeline::Run(*snap, paths);
+        for (const std::string& failure : report.failures) Utils::Log("Bench", "Export writer " + failure, Utils::YELLOW);
+        double serialMs = 0.0;
+        for (const auto& t : report.writers) serialMs += t.ms;
+        const auto& slowest = report.Slowest();
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(1) << "snapshot " << buildMs << " ms, writers " << report.total_ms
+           << " ms (slowest " << slowest.writer << " " << slowest.ms << " ms, sum " << serialMs << " ms)";
+        Utils::Log("Bench", "Export pipeline: " + os.str(), Utils::CYAN);
+        uintmax_t shardBytes = 0;
+        for (const auto& entry : fs::directory_iterator(fs::path(paths.output_dir) / DashboardView::SHARD_DIR)) shardBytes += entry.file_size();
+        Utils::Log("Bench", "Dashboard: shell " + std::to_string(fs::file_size(fs::path(paths.output_dir) / "leaderboard.html") / 1024) +
+                   " KB, " + std::to_string(VIEW_COUNT) + " view shards " + std::to_string(shardBytes / 1024) + " KB", Utils::CYAN);
+        // The shell, its assets and the worker must not reach outside their own
+        // files, and the page must not use a class nothing defines
+        std::vector<fs::path> shellFiles{fs::path(paths.output_dir) / "leaderboard.html", fs::path(paths.output_dir) / DashboardView::WORKER};
+        for (const auto& entry : fs::directory_iterator(fs::path(paths.output_dir) / DashboardView::ASSET_DIR)) shellFiles.push_back(entry.path());
+        bool selfContained = true;
+        for (const fs::path& file : shellFiles) {
+            std::ifstream in(file, std::ios::binary);
+            std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            if (text.find("://") == std::string::npos) continue;
+            Utils::Log("Bench", "Dashboard file references an external URL: " + file.filename().string(), Utils::YELLOW);
+            selfContained = false;
+        }
+        for (const std::string& name : DashboardView::UnstyledClasses()) {
+            Utils::Log("Bench", "Dashboard class has no compiled rule: " + name, Utils::YELLOW);
+            selfContained = false;
+        }
+
+        // Same snapshot again: every file matches what is on disk, nothing is written
+        report = ExportPipeline::Run(*snap, paths);
+        std::ostringstream rs;
+        rs << std::fixed << std::setprecision(1) << report.total_ms << " ms, " << report.files_replaced
+           << " files rewritten, " << report.files_unchanged << " unchanged";
+        Utils::Log("Bench", "Unchanged re-export: " + rs.str(), Utils::CYAN);
+        for (const std::string& failure : report.failures) Utils::Log("Bench", "Export writer " + failure, Utils::YELLOW);
+        bool ok = report.files_replaced == 0 && report.failed == 0;
+        if (report.files_replaced) Utils::Log("Bench", "Re-exporting an unchanged snapshot rewrote files", Utils::YELLOW);
+        ok = ok && selfContained;
+
+        if (!Compression::Available().empty()) {
+            paths.compress = true;
+            report = ExportPipeline::Run(*snap, paths);
+            fs::path html = fs::path(paths.output_dir) / "leaderboard.html";
+            std::ostringstream cs;
+            cs << std::fixed << std::setprecision(1) << "writers " << report.total_ms << " ms with siblings; dashboard "
+               << fs::file_size(html) / 1024 << " KB";
+            for (const char* ext : {".gz", ".zst"}) {
+                fs::path sibling = html.string() + ext;
+                if (fs::exists(sibling)) cs << ", " << ext << " " << fs::file_size(sibling) / 1024 << " KB";
+            }
+            Utils::Log("Bench", "Compressed exports (" + Compression::Available() + "): " + cs.str(), Utils::CYAN);
+        }
+        fs::remove_all(dir, ec);
+        return ok;
+    }
+
+    int Run(size_t n) {
+        ModelEntity::log_details = false;
+        Utils::Log("Bench", "Generating " + std::to_string(n) + " synthetic models...", Utils::CYAN);
+        std::vector<ModelEntity> registry = SyntheticRegistry(n);
+        bool ok = RankKernels(registry);
+        ok = OrderingDeterminism(std::min<size_t>(n, 20000)) && ok;
+        ExportSelection(registry);
+        ok = CsvEscaping() && ok;
+        ok = InterruptedWrite() && ok;
+        CsvThroughput(registry);
+        ok = ExportWriters(registry) && ok;
+        ok = NdjsonRecords(registry) && ok;
+        ok = SearchLookup(registry) && ok;
+        ok = FragmentReuse(registry) && ok;
+        ok = ModelPageReuse(std::min<size_t>(n, 5000)) && ok;
+        ok = ColumnarRoundTrip(registry) && ok;
+        WeightSweep(registry);
+        ok = Bootstrap(std::min<size_t>(n, 2000)) && ok;
+        return ok ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    int watchSeconds = 0;
+    std::string weightsPath;
+    size_t benchModels = 0;
+    size_t sweepSamples = 0;
+    size_t bootstrapIterations = 0;
+    bool compress = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--watch" && i + 1 < argc) watchSeconds = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--weights" && i + 1 < argc) weightsPath = argv[++i];
+        else if (arg == "--compress") compress = true;
+        else if (arg == "--bootstrap") bootstrapIterations = (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) ? std::stoul(argv[++i]) : 10000;
+        else if (arg == "--sweep") sweepSamples = (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) ? std::stoul(argv[++i]) : 100000;
+        else if (arg == "--bench") benchModels = (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) ? std::stoul(argv[++i]) : 100000;
+    }
+    if (benchModels > 0) return Bench::Run(benchModels);
+
     std::cout << Utils::BOLD << "\n=== CrossBench - AI Model Leaderboard Aggregator ===" << Utils::RESET << std::endl;
     std::cout << Utils::CYAN << "A Bias-Adjusted Aggregation of Multiple AI Leaderboards" << Utils::RESET << std::endl;
     std::cout << Utils::CYAN << "Live Data Source: api.zeroeval.com" << Utils::RESET << std::endl;
     std::cout << Utils::CYAN << "All Metrics Computed Dynamically\n" << Utils::RESET << std::endl;
     
     IntelligenceEngine engine;
+    if (!weightsPath.empty() && !engine.LoadWeights(weightsPath)) return 1;
+    if (compress) engine.EnableCompression();
     engine.Run();
     engine.ExportAll();
+    if (sweepSamples > 0) {
+        Sweep::Options opt;
+        opt.samples = sweepSamples;
+        engine.RunSweep(opt);
+    }
+    if (bootstrapIterations > 0) {
+        Resample::Options opt;
+        opt.iterations = bootstrapIterations;
+        engine.RunBootstrap(opt);
+    }
+    
+    // Watch mode: poll the API and re-rank only what changed
+    while (watchSeconds > 0) {
+        std::this_thread::sleep_for(std::chrono::seconds(watchSeconds));
+        if (engine.Refresh() > 0) engine.ExportAll();
+    }
     
     std::cout << Utils::GREEN << Utils::BOLD << "\n✓ Pipeline Complete" << Utils::RESET << std::endl;
     std::cout << "  Dashboard: " << Config::OUTPUT_DIR << "/leaderboard.html" << std::endl;